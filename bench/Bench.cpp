@@ -0,0 +1,389 @@
+#include "Cleanup.h"
+#include "Config.h"
+#include "Generator.h"
+#include "Pathfinder.h"
+#include "Presets.h"
+#include "ThreadPool.h"
+#include "map/ImgWriter.h"
+#include "structures/Lake.h"
+#include "structures/StructureUtil.h"
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+
+namespace
+{
+
+struct WorldSize {
+    const char *name;
+    int width;
+    int height;
+};
+
+constexpr std::array<WorldSize, 4> worldSizes{{
+    {"small", 4200, 1200},
+    {"medium", 6400, 1800},
+    {"large", 8400, 2400},
+    {"huge", 16800, 4800},
+}};
+
+constexpr std::array presetNames{
+    "none",
+    "bridges",
+    "buried",
+    "downfall",
+    "microcosm",
+    "mountaineer",
+    "webbed"};
+
+struct Options {
+    std::vector<std::string> seeds{"12345", "777"};
+    std::vector<std::string> presets{presetNames.begin(), presetNames.end()};
+    std::vector<std::string> sizes{"small", "medium", "large"};
+    int reps = 5;
+};
+
+std::vector<std::string> splitList(const std::string &list)
+{
+    std::vector<std::string> result;
+    size_t start = 0;
+    while (start <= list.size()) {
+        size_t end = std::min(list.find(',', start), list.size());
+        if (end > start) {
+            result.push_back(list.substr(start, end - start));
+        }
+        start = end + 1;
+    }
+    return result;
+}
+
+bool parseOptions(int argc, char **argv, Options &opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        size_t eq = arg.find('=');
+        std::string key = arg.substr(0, eq);
+        std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+        if (key == "--seeds") {
+            opts.seeds = splitList(value);
+        } else if (key == "--presets") {
+            opts.presets = splitList(value);
+        } else if (key == "--sizes") {
+            opts.sizes = splitList(value);
+        } else if (key == "--reps") {
+            opts.reps = std::max(std::atoi(value.c_str()), 1);
+        } else {
+            std::cerr << "Unknown option '" << arg << "'\n"
+                      << "Usage: " << argv[0]
+                      << " [--seeds=A,B] [--presets=none,bridges]"
+                         " [--sizes=small,medium,large,huge] [--reps=N]\n";
+            return false;
+        }
+    }
+    for (const std::string &size : opts.sizes) {
+        if (std::none_of(
+                worldSizes.begin(),
+                worldSizes.end(),
+                [&size](const WorldSize &entry) {
+                    return size == entry.name;
+                })) {
+            std::cerr << "Unknown size '" << size << "'\n";
+            return false;
+        }
+    }
+    for (const std::string &preset : opts.presets) {
+        if (std::find(presetNames.begin(), presetNames.end(), preset) ==
+            presetNames.end()) {
+            std::cerr << "Unknown preset '" << preset << "'\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Func> double timeSeconds(Func f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+std::string jsonString(const std::string &str)
+{
+    std::string result = "\"";
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+        }
+        result += c;
+    }
+    return result + '"';
+}
+
+struct WorldResult {
+    std::string seed;
+    std::string preset;
+    std::string size;
+    int width;
+    int height;
+    double generateTime;
+    double serializeTime;
+    size_t fileBytes;
+};
+
+struct PrimitiveResult {
+    std::string name;
+    std::vector<double> times;
+};
+
+Config getBenchConfig(
+    const std::string &seed,
+    const std::string &preset,
+    const WorldSize &size)
+{
+    Config conf = getDefaultConfig();
+    conf.name = "Bench";
+    conf.seed = seed;
+    conf.width = size.width;
+    conf.height = size.height;
+    conf.map = false;
+    applyPreset(preset, conf);
+    return conf;
+}
+
+/**
+ * Discards output, for timing serialization without disk writes.
+ */
+std::ostream &nullStream()
+{
+    static std::ostream out(nullptr);
+    return out;
+}
+
+std::vector<WorldResult> benchWorlds(const Options &opts)
+{
+    std::vector<WorldResult> results;
+    for (const std::string &sizeName : opts.sizes) {
+        const WorldSize &size = *std::find_if(
+            worldSizes.begin(),
+            worldSizes.end(),
+            [&sizeName](const WorldSize &entry) {
+                return sizeName == entry.name;
+            });
+        for (const std::string &preset : opts.presets) {
+            for (const std::string &seed : opts.seeds) {
+                Config conf = getBenchConfig(seed, preset, size);
+                // Presets that fix their own size give the same world at
+                // every size.
+                if (std::any_of(
+                        results.begin(),
+                        results.end(),
+                        [&](const WorldResult &prev) {
+                            return prev.seed == seed &&
+                                   prev.preset == preset &&
+                                   prev.width == conf.width &&
+                                   prev.height == conf.height;
+                        })) {
+                    continue;
+                }
+                std::cerr << "Generating " << seed << ' ' << preset << ' '
+                          << conf.width << 'x' << conf.height << '\n';
+                WorldResult result{
+                    seed,
+                    preset,
+                    size.name,
+                    conf.width,
+                    conf.height,
+                    0,
+                    0,
+                    0};
+                std::unique_ptr<GeneratedWorld> gen;
+                result.generateTime =
+                    timeSeconds([&gen, &conf]() { gen = generateWorld(conf); });
+                result.serializeTime = timeSeconds([&result, &gen]() {
+                    result.fileBytes = serializeWorld(*gen).size();
+                });
+                results.push_back(result);
+            }
+        }
+    }
+    return results;
+}
+
+/**
+ * Read back and remove a saved step profile.
+ */
+std::string takeStepProfile(const Config &conf)
+{
+    std::string filename = conf.getFilename() + "-profile.json";
+    std::ifstream in(filename);
+    std::string profile{
+        std::istreambuf_iterator<char>(in),
+        std::istreambuf_iterator<char>()};
+    in.close();
+    std::filesystem::remove(filename);
+    while (!profile.empty() && std::isspace(profile.back())) {
+        profile.pop_back();
+    }
+    return profile.empty() ? "[]" : profile;
+}
+
+/**
+ * Time primitives on one small world. Steps that only run once per world
+ * (such as genTreasure) are timed in place, by profiling generation of that
+ * world.
+ */
+std::vector<PrimitiveResult>
+benchPrimitives(const Options &opts, std::string &stepProfile)
+{
+    Config conf = getBenchConfig(opts.seeds.front(), "none", worldSizes[0]);
+    conf.profile = ProfileOutput::json;
+    std::cerr << "Profiling " << conf.seed << " for primitives\n";
+    auto gen = generateWorld(conf);
+    stepProfile = takeStepProfile(conf);
+    Random &rnd = gen->rnd;
+    World &world = gen->world;
+    std::vector<PrimitiveResult> results;
+    auto run = [&results, &opts](const std::string &name, auto body) {
+        std::cerr << "Timing " << name << '\n';
+        PrimitiveResult result{name, {}};
+        for (int i = 0; i < opts.reps; ++i) {
+            result.times.push_back(timeSeconds(body));
+        }
+        results.push_back(result);
+    };
+    // Accumulate noise samples, so sampling cannot be optimized out.
+    double noiseSum = 0;
+    // Noise samples are computed on first access, so each repetition samples
+    // a fresh stream, to time noise evaluation rather than cached lookups.
+    auto sampleNoise = [&noiseSum, &conf, &world](auto sample) {
+        return [&noiseSum, &conf, &world, sample]() {
+            Random noiseRnd;
+            noiseRnd.setSeed(conf.seed);
+            noiseRnd.initNoise(world.getWidth(), world.getHeight(), 0.07);
+            for (int x = 0; x < world.getWidth(); ++x) {
+                for (int y = 0; y < world.getHeight(); ++y) {
+                    noiseSum += sample(noiseRnd, x, y);
+                }
+            }
+        };
+    };
+    run("getCoarseNoise", sampleNoise([](Random &noiseRnd, int x, int y) {
+            return noiseRnd.getCoarseNoise(x, y);
+        }));
+    run("getFineNoise", sampleNoise([](Random &noiseRnd, int x, int y) {
+            return noiseRnd.getFineNoise(x, y);
+        }));
+    run("getBlurNoise", sampleNoise([](Random &noiseRnd, int x, int y) {
+            return noiseRnd.getBlurNoise(x, y);
+        }));
+    // Re-run generation steps on the finished world, so each repetition
+    // measures the step against slightly more placed content.
+    run("smoothSurfaces", [&world]() { smoothSurfaces(world); });
+    run("genLake", [&rnd, &world]() { genLake(rnd, world); });
+    run("saveWorldFile", [&gen]() { serializeWorld(*gen, nullStream()); });
+    run("saveWorldFileCompressed", [&gen]() {
+        gen->conf.compress = true;
+        serializeWorld(*gen, nullStream());
+        gen->conf.compress = false;
+    });
+    run("savePreviewImage", [&world]() { savePreviewImage("bench", world); });
+    std::filesystem::remove("bench-map.png");
+    auto pathCost = [&world](Point pt) {
+        return isSolidBlock(world.getTile(pt).blockID) ? 20 : 1;
+    };
+    auto pathBounds = [&world](Point pt) {
+        return pt.x > 50 && pt.y > 50 && pt.x < world.getWidth() - 50 &&
+               pt.y < world.getHeight() - 50;
+    };
+    int pathY = world.getUndergroundLevel();
+    run("findPathShort", [&]() {
+        findPath(
+            {world.getWidth() / 2 - 150, pathY},
+            {world.getWidth() / 2 + 150, pathY + 50},
+            pathCost,
+            pathBounds);
+    });
+    run("findPathLong", [&]() {
+        findPath(
+            {100, pathY},
+            {world.getWidth() - 100, pathY + 100},
+            pathCost,
+            pathBounds);
+    });
+    if (noiseSum == 0) {
+        std::cerr << "Noise sampled to zero\n";
+    }
+    return results;
+}
+
+void printJson(
+    const std::vector<WorldResult> &worlds,
+    const std::vector<PrimitiveResult> &primitives,
+    const std::string &stepProfile)
+{
+    std::cout << "{\n  \"threads\": " << ThreadPool::get().getNumThreads()
+              << ",\n  \"worlds\": [\n";
+    for (size_t i = 0; i < worlds.size(); ++i) {
+        const auto &world = worlds[i];
+        std::cout << "    {\"seed\": " << jsonString(world.seed)
+                  << ", \"preset\": " << jsonString(world.preset)
+                  << ", \"size\": \"" << world.size
+                  << "\", \"width\": " << world.width
+                  << ", \"height\": " << world.height
+                  << ", \"generateSeconds\": " << world.generateTime
+                  << ", \"serializeSeconds\": " << world.serializeTime
+                  << ", \"fileBytes\": " << world.fileBytes << '}'
+                  << (i + 1 < worlds.size() ? ",\n" : "\n");
+    }
+    std::cout << "  ],\n  \"primitives\": [\n";
+    for (size_t i = 0; i < primitives.size(); ++i) {
+        std::vector<double> times = primitives[i].times;
+        std::sort(times.begin(), times.end());
+        std::cout << "    {\"name\": \"" << primitives[i].name
+                  << "\", \"reps\": " << times.size()
+                  << ", \"minSeconds\": " << times.front()
+                  << ", \"medianSeconds\": " << times[times.size() / 2]
+                  << ", \"meanSeconds\": "
+                  << std::accumulate(times.begin(), times.end(), 0.0) /
+                         times.size()
+                  << '}' << (i + 1 < primitives.size() ? ",\n" : "\n");
+    }
+    std::cout << "  ],\n  \"steps\": " << stepProfile << "\n}\n";
+}
+
+} // namespace
+
+/**
+ * Time full generation over a matrix of seeds, presets, and world sizes, then
+ * time hot primitives and each generation step on one small world. Results go
+ * to stdout as JSON; progress goes to stderr.
+ */
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parseOptions(argc, argv, opts) || opts.seeds.empty()) {
+        return 1;
+    }
+    int threads = 0;
+    if (const char *envThreads = std::getenv("TERRA_AWG_THREADS")) {
+        threads = std::atoi(envThreads);
+    }
+    ThreadPool::get().setNumThreads(threads);
+    // Silence per-step progress output from generation.
+    std::streambuf *outBuf = std::cout.rdbuf(nullptr);
+    auto worlds = benchWorlds(opts);
+    std::string stepProfile;
+    auto primitives = benchPrimitives(opts, stepProfile);
+    std::cout.rdbuf(outBuf);
+    printJson(worlds, primitives, stepProfile);
+    return 0;
+}
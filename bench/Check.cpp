@@ -0,0 +1,359 @@
+#include "Config.h"
+#include "Generator.h"
+#include "Pathfinder.h"
+#include "ThreadPool.h"
+#include "vendor/OpenSimplexNoise.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <numbers>
+#include <queue>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+/**
+ * Compare batch 4D OpenSimplexNoise::Evaluate() against per-point scalar
+ * evaluation. Results must be bit-identical, as generated worlds depend on
+ * them.
+ *
+ * @return Number of mismatched points.
+ */
+int checkNoiseBatch(
+    OpenSimplexNoise &simplex,
+    const std::array<std::vector<double>, 4> &points,
+    const char *name)
+{
+    const auto &[xs, ys, zs, ws] = points;
+    std::vector<double> batch(xs.size());
+    // Vary batch length, to cover both the paired path and the odd tail.
+    size_t start = 0;
+    for (size_t count = 1; start < xs.size(); count = count % 67 + 1) {
+        count = std::min(count, xs.size() - start);
+        simplex.Evaluate(
+            xs.data() + start,
+            ys.data() + start,
+            zs.data() + start,
+            ws.data() + start,
+            batch.data() + start,
+            count);
+        start += count;
+    }
+    int mismatches = 0;
+    for (size_t i = 0; i < xs.size(); ++i) {
+        double scalar = simplex.Evaluate(xs[i], ys[i], zs[i], ws[i]);
+        if (std::memcmp(&scalar, &batch[i], sizeof(double)) != 0) {
+            if (mismatches < 10) {
+                std::cerr << name << ": mismatch at (" << xs[i] << ", "
+                          << ys[i] << ", " << zs[i] << ", " << ws[i]
+                          << "): scalar " << scalar << ", batch " << batch[i]
+                          << '\n';
+            }
+            ++mismatches;
+        }
+    }
+    std::cerr << name << ": " << xs.size() - mismatches << " of "
+              << xs.size() << " points match\n";
+    return mismatches;
+}
+
+int checkNoise()
+{
+    std::mt19937_64 rnd(12345);
+    OpenSimplexNoise simplex(static_cast<int64_t>(rnd()));
+    int mismatches = 0;
+    constexpr size_t numPoints = 100000;
+    // Uniform points, at several magnitudes.
+    for (double range : {1.0, 64.0, 4096.0}) {
+        std::uniform_real_distribution<double> dist(-range, range);
+        std::array<std::vector<double>, 4> points;
+        for (auto &coords : points) {
+            for (size_t i = 0; i < numPoints; ++i) {
+                coords.push_back(dist(rnd));
+            }
+        }
+        std::string name = "uniform +/-" + std::to_string(int(range));
+        mismatches += checkNoiseBatch(simplex, points, name.c_str());
+    }
+    // Lattice aligned points, where floor() and region choices are on edge.
+    {
+        std::uniform_int_distribution<int> dist(-64, 64);
+        std::array<std::vector<double>, 4> points;
+        for (auto &coords : points) {
+            for (size_t i = 0; i < numPoints; ++i) {
+                coords.push_back(0.5 * dist(rnd));
+            }
+        }
+        mismatches += checkNoiseBatch(simplex, points, "lattice");
+    }
+    // World shaped columns, as sampled by Random::initNoise().
+    {
+        constexpr int width = 4200;
+        constexpr int height = 1200;
+        constexpr double scale = 1 / 8.0;
+        double radiusX = scale * width * 0.5 * std::numbers::inv_pi;
+        double radiusY = scale * height * 0.5 * std::numbers::inv_pi;
+        std::array<std::vector<double>, 4> points;
+        for (int x = 0; x < width; x += 97) {
+            double tX = 2 * std::numbers::pi * x / width;
+            for (int y = 0; y < height; ++y) {
+                double tY = 2 * std::numbers::pi * y / height;
+                points[0].push_back(radiusX * std::cos(tX));
+                points[1].push_back(radiusX * std::sin(tX));
+                points[2].push_back(radiusY * std::cos(tY));
+                points[3].push_back(radiusY * std::sin(tY));
+            }
+        }
+        mismatches += checkNoiseBatch(simplex, points, "world columns");
+    }
+    return mismatches;
+}
+
+/**
+ * The std::map based A* search that detail::aStarSearch() replaced, kept as a
+ * reference for its paths. Resulting path is reversed.
+ */
+template <typename NodeCost, typename BoundsCheck>
+std::vector<Point> referenceAStarSearch(
+    Point start,
+    Point goal,
+    NodeCost costAt,
+    BoundsCheck isValid)
+{
+    std::map<Point, int> costEst{{start, detail::distHeuristic(start, goal)}};
+    auto costCmp = [&costEst](const Point &a, const Point &b) {
+        auto itrA = costEst.find(a);
+        int costA = itrA == costEst.end() ? std::numeric_limits<int>::max()
+                                          : itrA->second;
+        auto itrB = costEst.find(b);
+        int costB = itrB == costEst.end() ? std::numeric_limits<int>::max()
+                                          : itrB->second;
+        return costA > costB;
+    };
+    std::priority_queue<Point, std::vector<Point>, decltype(costCmp)> frontier{
+        costCmp};
+    frontier.push(start);
+    std::map<Point, int> exactCostTo{{start, 0}};
+    std::map<Point, Point> parents;
+    while (!frontier.empty()) {
+        Point current = frontier.top();
+        if (current == goal) {
+            std::vector<Point> path;
+            while (true) {
+                path.push_back(current);
+                auto itr = parents.find(current);
+                if (itr == parents.end()) {
+                    break;
+                }
+                current = itr->second;
+            }
+            return path;
+        }
+        frontier.pop();
+        for (Point delta : {Point{1, 0}, {-1, 0}, {0, 1}, {0, -1}}) {
+            Point neighbor = current + delta;
+            if (isValid(neighbor) && !costEst.contains(neighbor)) {
+                int stepCost = exactCostTo[current] + costAt(neighbor);
+                exactCostTo[neighbor] = stepCost;
+                costEst[neighbor] =
+                    stepCost + detail::distHeuristic(neighbor, goal);
+                frontier.push(neighbor);
+                parents[neighbor] = current;
+            }
+        }
+    }
+    return {};
+}
+
+/**
+ * findPath(), splitting paths the same way, over referenceAStarSearch().
+ * Halves run one after the other; they are independent, so paths match.
+ */
+template <typename NodeCost, typename BoundsCheck>
+std::vector<Point>
+referenceFindPath(Point from, Point to, NodeCost costAt, BoundsCheck isValid)
+{
+    if (hypot(from, to) < 400) {
+        return referenceAStarSearch(to, from, costAt, isValid);
+    }
+    Point mid = detail::cheapestPointNear(
+        {std::midpoint(from.x, to.x), std::midpoint(from.y, to.y)},
+        costAt);
+    std::vector<Point> path = referenceFindPath(from, mid, costAt, isValid);
+    std::vector<Point> segment = referenceFindPath(mid, to, costAt, isValid);
+    if (path.empty() || segment.empty()) {
+        return {};
+    }
+    detail::joinPath(path, segment.begin(), segment.end());
+    return path;
+}
+
+template <typename Func> double timeSeconds(Func f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+/**
+ * Compare findPath() against referenceFindPath() on long paths over a
+ * synthetic world sized cost field, and report the time each takes.
+ *
+ * @return Number of mismatched paths.
+ */
+int checkPaths()
+{
+    constexpr int width = 4200;
+    constexpr int height = 1200;
+    // Blobs of expensive "solid" tiles, costed like tunnel pathing.
+    OpenSimplexNoise simplex(777);
+    std::vector<int> costs(width * height);
+    for (int x = 0; x < width; ++x) {
+        for (int y = 0; y < height; ++y) {
+            costs[y + x * height] =
+                simplex.Evaluate(x / 40.0, y / 40.0) > 0.1 ? 20 : 1;
+        }
+    }
+    auto costAt = [&costs](Point pt) { return costs[pt.y + pt.x * height]; };
+    auto isValid = [](Point pt) {
+        return pt.x > 50 && pt.y > 50 && pt.x < width - 50 &&
+               pt.y < height - 50;
+    };
+    std::vector<std::pair<Point, Point>> queries{
+        {{100, 300}, {1300, 400}},
+        {{2000, 200}, {3000, 900}},
+        {{3900, 1000}, {2800, 150}},
+        {{600, 1100}, {1700, 100}},
+    };
+    int mismatches = 0;
+    double time = 0;
+    double referenceTime = 0;
+    size_t pathTiles = 0;
+    for (auto [from, to] : queries) {
+        std::vector<Point> path;
+        std::vector<Point> referencePath;
+        time += timeSeconds([&]() {
+            path = findPath(from, to, costAt, isValid);
+        });
+        referenceTime += timeSeconds([&]() {
+            referencePath = referenceFindPath(from, to, costAt, isValid);
+        });
+        pathTiles += path.size();
+        if (path.empty() || path != referencePath) {
+            std::cerr << "findPath: mismatch from (" << from.x << ", "
+                      << from.y << ") to (" << to.x << ", " << to.y
+                      << "): " << path.size() << " tiles, reference "
+                      << referencePath.size() << " tiles\n";
+            ++mismatches;
+        }
+    }
+    std::cerr << "findPath: " << queries.size() - mismatches << " of "
+              << queries.size() << " paths match (" << pathTiles
+              << " tiles); " << time << "s, reference " << referenceTime
+              << "s\n";
+    return mismatches;
+}
+
+/**
+ * Compare everything a world file is built from: tiles, chests, and surface
+ * levels.
+ */
+bool sameWorld(World &a, World &b)
+{
+    if (a.getWidth() != b.getWidth() || a.getHeight() != b.getHeight() ||
+        a.getChests().size() != b.getChests().size()) {
+        return false;
+    }
+    for (int x = 0; x < a.getWidth(); ++x) {
+        if (!std::ranges::equal(a.column(x), b.column(x)) ||
+            a.getSurfaceLevel(x) != b.getSurfaceLevel(x)) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < a.getChests().size(); ++i) {
+        const Chest &chestA = a.getChests()[i];
+        const Chest &chestB = b.getChests()[i];
+        if (chestA.x != chestB.x || chestA.y != chestB.y ||
+            !std::ranges::equal(
+                chestA.items,
+                chestB.items,
+                [](const Item &itemA, const Item &itemB) {
+                    return itemA.id == itemB.id &&
+                           itemA.prefix == itemB.prefix &&
+                           itemA.stack == itemB.stack;
+                })) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Compare worlds generated on one thread against worlds generated on several.
+ * Results must be identical, as seeds are shared between machines.
+ *
+ * @return Number of mismatched worlds.
+ */
+int checkThreads()
+{
+    Config conf = getDefaultConfig();
+    conf.seed = "12345";
+    conf.width = 4200;
+    conf.height = 1200;
+    conf.map = false;
+    Config secretConf = conf;
+    secretConf.forTheWorthy = true;
+    secretConf.hardmode = true;
+    secretConf.hiveQueen = true;
+    secretConf.shattered = true;
+    int numThreads = std::max(4u, std::thread::hardware_concurrency());
+    int mismatches = 0;
+    for (auto [name, worldConf] :
+         {std::pair{"default", conf}, {"secret seeds", secretConf}}) {
+        // Silence per-step progress output from generation.
+        std::streambuf *outBuf = std::cout.rdbuf(nullptr);
+        ThreadPool::get().setNumThreads(1);
+        auto serial = generateWorld(worldConf);
+        ThreadPool::get().setNumThreads(numThreads);
+        auto parallel = generateWorld(worldConf);
+        std::cout.rdbuf(outBuf);
+        bool matches =
+            serial && parallel && sameWorld(serial->world, parallel->world);
+        if (!matches) {
+            ++mismatches;
+        }
+        std::cerr << "threads: " << name << " world "
+                  << (matches ? "matches" : "differs") << " on 1 and "
+                  << numThreads << " threads\n";
+    }
+    return mismatches;
+}
+
+} // namespace
+
+/**
+ * Check optimized code paths against their reference implementations, and
+ * multi-threaded generation against single-threaded. Exits non-zero on any
+ * mismatch.
+ */
+int main()
+{
+    int failures = checkNoise() + checkPaths() + checkThreads();
+    if (failures > 0) {
+        std::cerr << failures << " checks failed\n";
+        return 1;
+    }
+    std::cerr << "All checks passed\n";
+    return 0;
+}
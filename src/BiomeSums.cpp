@@ -0,0 +1,151 @@
+#include "BiomeSums.h"
+
+#include "World.h"
+#include <algorithm>
+
+BiomeSums::BiomeSums(
+    const std::vector<BiomeData> &biomeMap,
+    int width,
+    int height)
+    : biomeMap(biomeMap), width(width), height(height),
+      blocksX((width + blockSize - 1) / blockSize),
+      blocksY((height + blockSize - 1) / blockSize)
+{
+}
+
+double BiomeSums::getWeight(Biome biome, int x, int y) const
+{
+    const BiomeData &data = biomeMap[y + x * height];
+    switch (biome) {
+    case Biome::forest:
+        return data.forest;
+    case Biome::snow:
+        return data.snow;
+    case Biome::desert:
+        return data.desert;
+    case Biome::jungle:
+        return data.jungle;
+    case Biome::underworld:
+        return data.underworld;
+    }
+    return 0;
+}
+
+double BiomeSums::sumDirect(Biome biome, int x1, int y1, int x2, int y2) const
+{
+    double total = 0;
+    for (int x = x1; x < x2; ++x) {
+        for (int y = y1; y < y2; ++y) {
+            total += getWeight(biome, x, y);
+        }
+    }
+    return total;
+}
+
+void BiomeSums::refresh(Biome biome)
+{
+    Table &table = tables[static_cast<int>(biome)];
+    if (!table.built) {
+        table.blockSums.resize(blocksX * blocksY);
+        table.areaSums.resize((blocksX + 1) * (blocksY + 1));
+        table.dirty.assign(blocksX * blocksY, true);
+        table.built = true;
+        table.anyDirty = true;
+    }
+    if (!table.anyDirty) {
+        return;
+    }
+    for (int bx = 0; bx < blocksX; ++bx) {
+        for (int by = 0; by < blocksY; ++by) {
+            int idx = by + bx * blocksY;
+            if (table.dirty[idx]) {
+                table.blockSums[idx] = sumDirect(
+                    biome,
+                    bx * blockSize,
+                    by * blockSize,
+                    std::min((bx + 1) * blockSize, width),
+                    std::min((by + 1) * blockSize, height));
+                table.dirty[idx] = false;
+            }
+        }
+    }
+    for (int bx = 0; bx < blocksX; ++bx) {
+        for (int by = 0; by < blocksY; ++by) {
+            table.areaSums[(by + 1) + (bx + 1) * (blocksY + 1)] =
+                table.blockSums[by + bx * blocksY] +
+                table.areaSums[by + (bx + 1) * (blocksY + 1)] +
+                table.areaSums[(by + 1) + bx * (blocksY + 1)] -
+                table.areaSums[by + bx * (blocksY + 1)];
+        }
+    }
+    table.anyDirty = false;
+}
+
+void BiomeSums::invalidate(int x, int y, int w, int h)
+{
+    int bx1 = std::max(x, 0) / blockSize;
+    int bx2 = (std::min(x + w, width) + blockSize - 1) / blockSize;
+    int by1 = std::max(y, 0) / blockSize;
+    int by2 = (std::min(y + h, height) + blockSize - 1) / blockSize;
+    if (bx1 >= bx2 || by1 >= by2) {
+        return;
+    }
+    std::lock_guard lock{mut};
+    for (Table &table : tables) {
+        if (!table.built) {
+            continue;
+        }
+        for (int bx = bx1; bx < bx2; ++bx) {
+            for (int by = by1; by < by2; ++by) {
+                table.dirty[by + bx * blocksY] = true;
+            }
+        }
+        table.anyDirty = true;
+    }
+}
+
+double BiomeSums::sum(Biome biome, int x, int y, int w, int h)
+{
+    if (w <= 0 || h <= 0) {
+        return 0;
+    }
+    int x1 = std::max(x, 0);
+    int x2 = std::min(x + w, width);
+    int y1 = std::max(y, 0);
+    int y2 = std::min(y + h, height);
+    double outside = static_cast<double>(w) * h;
+    if (x1 < x2 && y1 < y2) {
+        outside -= static_cast<double>(x2 - x1) * (y2 - y1);
+    }
+    double total = outside * getWeight(biome, 0, 0);
+    if (x1 >= x2 || y1 >= y2) {
+        return total;
+    }
+    // Whole blocks inside the clipped area.
+    int bx1 = (x1 + blockSize - 1) / blockSize;
+    int bx2 = x2 / blockSize;
+    int by1 = (y1 + blockSize - 1) / blockSize;
+    int by2 = y2 / blockSize;
+    if (bx2 - bx1 < 2 || by2 - by1 < 2) {
+        return total + sumDirect(biome, x1, y1, x2, y2);
+    }
+    {
+        std::lock_guard lock{mut};
+        refresh(biome);
+        const std::vector<double> &areaSums =
+            tables[static_cast<int>(biome)].areaSums;
+        total += areaSums[by2 + bx2 * (blocksY + 1)] -
+                 areaSums[by1 + bx2 * (blocksY + 1)] -
+                 areaSums[by2 + bx1 * (blocksY + 1)] +
+                 areaSums[by1 + bx1 * (blocksY + 1)];
+    }
+    int innerX1 = bx1 * blockSize;
+    int innerX2 = bx2 * blockSize;
+    int innerY1 = by1 * blockSize;
+    int innerY2 = by2 * blockSize;
+    total += sumDirect(biome, x1, y1, x2, innerY1);
+    total += sumDirect(biome, x1, innerY2, x2, y2);
+    total += sumDirect(biome, x1, innerY1, innerX1, innerY2);
+    total += sumDirect(biome, innerX2, innerY1, x2, innerY2);
+    return total;
+}
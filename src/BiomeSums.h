@@ -0,0 +1,62 @@
+#ifndef BIOMESUMS_H
+#define BIOMESUMS_H
+
+#include "ids/Biome.h"
+#include <array>
+#include <mutex>
+#include <vector>
+
+struct BiomeData;
+
+/**
+ * Window sums of biome weights. Each biome has a summed-area table over
+ * square blocks of the biome map, built on first query. Whole blocks inside a
+ * window come from the table; partial blocks along its edges are summed
+ * directly.
+ *
+ * Code that changes biome weights must call invalidate() on the changed area.
+ */
+class BiomeSums
+{
+private:
+    static constexpr int blockSize = 8;
+
+    struct Table {
+        std::vector<double> blockSums;
+        /**
+         * Summed-area table of blockSums, with a leading zero row and column.
+         */
+        std::vector<double> areaSums;
+        std::vector<bool> dirty;
+        bool built = false;
+        bool anyDirty = false;
+    };
+
+    const std::vector<BiomeData> &biomeMap;
+    int width;
+    int height;
+    int blocksX;
+    int blocksY;
+    std::array<Table, 5> tables;
+    std::mutex mut;
+
+    double getWeight(Biome biome, int x, int y) const;
+    double sumDirect(Biome biome, int x1, int y1, int x2, int y2) const;
+    void refresh(Biome biome);
+
+public:
+    BiomeSums(const std::vector<BiomeData> &biomeMap, int width, int height);
+
+    /**
+     * Mark biome weights in the area as changed.
+     */
+    void invalidate(int x, int y, int w, int h);
+
+    /**
+     * Sum of a biome's weight over the area. Locations outside the world
+     * count with the weight of (0, 0), matching World::getBiome().
+     */
+    double sum(Biome biome, int x, int y, int w, int h);
+};
+
+#endif // BIOMESUMS_H
@@ -6,10 +6,10 @@
 #include "World.h"
 #include "biomes/BiomeUtil.h"
 #include "ids/Paint.h"
+#include "ids/TileTraits.h"
 #include "ids/WallID.h"
 #include "structures/StructureUtil.h"
 #include "structures/glitched/Cleanup.h"
-#include "vendor/frozen/map.h"
 #include "vendor/frozen/set.h"
 #include <algorithm>
 #include <iostream>
@@ -39,7 +39,9 @@ std::pair<int, int> getAttachedOpenWall(World &world, int x, int y)
             }
         }
     }
-    return keepOrigin ? std::pair{origin.wallID, origin.wallPaint} : res;
+    return keepOrigin
+               ? std::pair<int, int>{origin.wallID, origin.wallPaint}
+               : res;
 }
 
 Slope computeSlope(World &world, int x, int y)
@@ -109,116 +111,38 @@ Slope computeSlope(World &world, int x, int y)
 void smoothSurfaces(World &world)
 {
     std::cout << "Smoothing surfaces\n";
-    constexpr auto stablizeBlocks = frozen::make_map<int, int>({
-        {TileID::sand, TileID::hardenedSand},
-        {TileID::ebonsand, TileID::hardenedEbonsand},
-        {TileID::pearlsand, TileID::hardenedPearlsand},
-        {TileID::silt, TileID::mud},
-        {TileID::slush, TileID::snow},
-        {TileID::crimsand, TileID::hardenedCrimsand},
-        {TileID::shellPile, TileID::hardenedSand},
-    });
-    constexpr auto slopedTiles = frozen::make_set<int>({
-        TileID::dirt,
-        TileID::stone,
-        TileID::grass,
-        TileID::corruptGrass,
-        TileID::ebonstone,
-        TileID::meteorite,
-        TileID::clay,
-        TileID::sand,
-        TileID::obsidian,
-        TileID::ash,
-        TileID::mud,
-        TileID::jungleGrass,
-        TileID::mushroomGrass,
-        TileID::hallowedGrass,
-        TileID::ebonsand,
-        TileID::pearlsand,
-        TileID::pearlstone,
-        TileID::silt,
-        TileID::candyCane,
-        TileID::greenCandyCane,
-        TileID::snow,
-        TileID::ice,
-        TileID::corruptIce,
-        TileID::hallowedIce,
-        TileID::pineTree,
-        TileID::cloud,
-        TileID::livingWood,
-        TileID::leaf,
-        TileID::slime,
-        TileID::flesh,
-        TileID::rainCloud,
-        TileID::crimsonGrass,
-        TileID::crimsonIce,
-        TileID::crimstone,
-        TileID::slush,
-        TileID::hive,
-        TileID::honey,
-        TileID::crispyHoney,
-        TileID::crimsand,
-        TileID::coralstone,
-        TileID::smoothMarble,
-        TileID::marble,
-        TileID::granite,
-        TileID::smoothGranite,
-        TileID::pinkSlime,
-        TileID::lavaMossStone,
-        TileID::livingMahogany,
-        TileID::mahoganyLeaf,
-        TileID::crystalBlock,
-        TileID::sandstone,
-        TileID::hardenedSand,
-        TileID::hardenedEbonsand,
-        TileID::hardenedCrimsand,
-        TileID::ebonsandstone,
-        TileID::crimsandstone,
-        TileID::hardenedPearlsand,
-        TileID::pearlsandstone,
-        TileID::snowCloud,
-        TileID::lesion,
-        TileID::kryptonMossStone,
-        TileID::xenonMossStone,
-        TileID::argonMossStone,
-        TileID::neonMossStone,
-        TileID::heliumMossStone,
-        TileID::ashGrass,
-        TileID::corruptJungleGrass,
-        TileID::crimsonJungleGrass,
-        TileID::aetherium,
-    });
-    parallelFor(
-        std::views::iota(0, world.getWidth()),
-        [&stablizeBlocks, &slopedTiles, &world](int x) {
-            for (int y = 0; y < world.getHeight(); ++y) {
-                Tile &tile = world.getTile(x, y);
-                if (tile.guarded || !isSolidBlock(tile.blockID) ||
-                    !world.isExposed(x, y)) {
-                    continue;
-                }
-                if (tile.wallID != WallID::empty) {
-                    // Blend with surrounding walls by matching wall type
-                    // used/blank in orthogonal non-block-covered space.
-                    std::tie(tile.wallID, tile.wallPaint) =
-                        getAttachedOpenWall(world, x, y);
-                }
-                if (world.isIsolated(x, y)) {
-                    tile.blockID = TileID::empty;
-                    continue;
-                }
-                if (!isSolidBlock(world.getTile(x, y + 1).blockID)) {
-                    // Stop falling sand.
-                    auto itr = stablizeBlocks.find(tile.blockID);
-                    if (itr != stablizeBlocks.end()) {
-                        tile.blockID = itr->second;
-                    }
-                }
-                if (slopedTiles.contains(tile.blockID)) {
-                    tile.slope = computeSlope(world, x, y);
+    // Each tile reads blocks and walls its neighbors may have changed, so
+    // columns run in order to keep the result independent of thread count.
+    for (int x = 0; x < world.getWidth(); ++x) {
+        std::span<Tile> column = world.column(x);
+        for (int y = 0; y < world.getHeight(); ++y) {
+            Tile &tile = column[y];
+            if (tile.guarded || !isSolidBlock(tile.blockID) ||
+                !world.isExposed(x, y)) {
+                continue;
+            }
+            if (tile.wallID != WallID::empty) {
+                // Blend with surrounding walls by matching wall type
+                // used/blank in orthogonal non-block-covered space.
+                std::tie(tile.wallID, tile.wallPaint) =
+                    getAttachedOpenWall(world, x, y);
+            }
+            if (world.isIsolated(x, y)) {
+                tile.blockID = TileID::empty;
+                continue;
+            }
+            if (!isSolidBlock(column[y + 1].blockID)) {
+                // Stop falling sand.
+                int stabilized = blockTraits(tile.blockID).stabilized;
+                if (stabilized != TileID::empty) {
+                    tile.blockID = stabilized;
                 }
             }
-        });
+            if (blockTraits(tile.blockID).is(BlockTrait::sloped)) {
+                tile.slope = computeSlope(world, x, y);
+            }
+        }
+    }
 }
 
 void applyCelebrationFinalize(int x, int y, int rainbowOffset, World &world)
@@ -340,38 +264,33 @@ void finalizeWalls(Random &rnd, World &world)
     double stoneBound =
         (4 * world.getCavernLevel() + world.getUnderworldLevel()) / 5;
     int rainbowOffset = rnd.getInt(0, 999);
-    parallelFor(
-        std::views::iota(0, world.getWidth()),
-        [mossBound,
-         stoneBound,
-         rainbowOffset,
-         &mosses,
-         &stoneWalls,
-         &rnd,
-         &world](int x) {
-            for (int y = 0; y < world.getHeight(); ++y) {
-                applyCelebrationFinalize(x, y, rainbowOffset, world);
-                applyGlitchedFinalize(x, y, rnd, world);
-                if (y < world.getUndergroundLevel()) {
-                    continue;
-                }
-                double threshold = 15 * (mossBound - y) / world.getHeight();
-                if (rnd.getCoarseNoise(x, y) < threshold) {
-                    continue;
-                }
-                Tile &tile = world.getTile(x, y);
-                auto itr = stoneWalls.find(tile.wallID);
-                if (itr != stoneWalls.end() && world.isExposed(x, y) &&
-                    convertToMoss(x, y, tile, mosses, rnd, world)) {
-                    continue;
-                }
-                threshold = 15 * (stoneBound - y) / world.getHeight();
-                if (rnd.getCoarseNoise(x, y) < threshold) {
-                    continue;
-                }
-                if (tile.blockID != TileID::dirt && itr != stoneWalls.end()) {
-                    tile.wallID = itr->second;
-                }
+    // Moss grows plants into neighboring columns, changing which tiles are
+    // exposed there, so columns run in order to keep the result independent
+    // of thread count.
+    for (int x = 0; x < world.getWidth(); ++x) {
+        for (int y = 0; y < world.getHeight(); ++y) {
+            applyCelebrationFinalize(x, y, rainbowOffset, world);
+            applyGlitchedFinalize(x, y, rnd, world);
+            if (y < world.getUndergroundLevel()) {
+                continue;
+            }
+            double threshold = 15 * (mossBound - y) / world.getHeight();
+            if (rnd.getCoarseNoise(x, y) < threshold) {
+                continue;
             }
-        });
+            Tile &tile = world.getTile(x, y);
+            auto itr = stoneWalls.find(tile.wallID);
+            if (itr != stoneWalls.end() && world.isExposed(x, y) &&
+                convertToMoss(x, y, tile, mosses, rnd, world)) {
+                continue;
+            }
+            threshold = 15 * (stoneBound - y) / world.getHeight();
+            if (rnd.getCoarseNoise(x, y) < threshold) {
+                continue;
+            }
+            if (tile.blockID != TileID::dirt && itr != stoneWalls.end()) {
+                tile.wallID = itr->second;
+            }
+        }
+    }
 }
@@ -5,7 +5,9 @@
 #include "ids/ItemID.h"
 #include "ids/TileID.h"
 #include "vendor/INIReader.h"
+#include <algorithm>
 #include <array>
+#include <charconv>
 #include <cstring>
 #include <filesystem>
 #include <fstream>
@@ -249,6 +251,44 @@ vampirism = false
 [extra]
 # Output a map preview image.
 map = true
+
+# Number of threads to generate with. Use 0 to match the number of CPU
+# cores. The TERRA_AWG_THREADS environment variable overrides this.
+threads = 0
+
+# Save the world gzip compressed, as a .wld.gz file. Terraria cannot load
+# these directly; decompress before use.
+compress = false
+
+# Record wall time, CPU time, peak memory growth, and changed tile count for
+# each generation step. "table" prints a summary. "json" and "trace" also save
+# the results to <name>-profile.json, "trace" in Chrome trace event format.
+# Options:
+#   none/table/json/trace
+profile = none
+
+[scan]
+# Generate many seeds in one run, saving only the worlds that match every
+# criterion below. Matching worlds are named "<name> <seed>". Either an
+# inclusive range of numeric seeds:
+#   1000-1999
+# or a comma separated list of seeds. Leave empty to generate a single world
+# from the [world] seed. Each thread generates its own world, so memory use
+# scales with [extra] threads.
+seeds =
+
+# Options:
+#   any/left/right
+dungeonSide = any
+
+# Comma separated biomes accepted at the spawn point. Leave empty to accept
+# any.
+# Options:
+#   forest/snow/desert/jungle/underworld
+spawnBiome =
+
+# Comma separated item IDs that must each appear in at least one chest.
+chestItems =
 )";
 
 // clang-format off
@@ -647,6 +687,99 @@ AetherBiome parseAetherBiome(const std::string &aether)
     return AetherBiome::random;
 }
 
+ProfileOutput parseProfileOutput(const std::string &profile)
+{
+    if (profile == "table") {
+        return ProfileOutput::table;
+    } else if (profile == "json") {
+        return ProfileOutput::json;
+    } else if (profile == "trace") {
+        return ProfileOutput::trace;
+    } else if (profile != "none") {
+        std::cout << "Unknown profile output '" << profile << "'\n";
+    }
+    return ProfileOutput::none;
+}
+
+std::vector<std::string> splitList(const std::string &list)
+{
+    std::vector<std::string> parts;
+    size_t pos = 0;
+    while (pos <= list.size()) {
+        size_t next = std::min(list.find(',', pos), list.size());
+        size_t first = list.find_first_not_of(" \t", pos);
+        size_t last = list.find_last_not_of(" \t", next - 1);
+        if (first < next) {
+            parts.push_back(list.substr(first, last - first + 1));
+        }
+        pos = next + 1;
+    }
+    return parts;
+}
+
+DungeonSide parseDungeonSide(const std::string &side)
+{
+    if (side == "left") {
+        return DungeonSide::left;
+    } else if (side == "right") {
+        return DungeonSide::right;
+    } else if (side != "any") {
+        std::cout << "Unknown dungeon side '" << side << "'\n";
+    }
+    return DungeonSide::any;
+}
+
+std::vector<Biome> parseBiomeList(const std::string &biomes)
+{
+    std::vector<Biome> result;
+    for (const std::string &biome : splitList(biomes)) {
+        if (biome == "forest") {
+            result.push_back(Biome::forest);
+        } else if (biome == "snow") {
+            result.push_back(Biome::snow);
+        } else if (biome == "desert") {
+            result.push_back(Biome::desert);
+        } else if (biome == "jungle") {
+            result.push_back(Biome::jungle);
+        } else if (biome == "underworld") {
+            result.push_back(Biome::underworld);
+        } else {
+            std::cout << "Unknown biome '" << biome << "'\n";
+        }
+    }
+    return result;
+}
+
+/**
+ * Parse a whole string (ignoring surrounding blanks) as a non-negative
+ * integer. Returns false if it is not a number, or does not fit in T.
+ */
+template <typename T> bool parseNumber(const std::string &str, T &value)
+{
+    size_t first = str.find_first_not_of(" \t");
+    size_t last = str.find_last_not_of(" \t");
+    if (first == std::string::npos || !std::isdigit(str[first])) {
+        return false;
+    }
+    auto [ptr, err] =
+        std::from_chars(str.data() + first, str.data() + last + 1, value);
+    return err == std::errc{} && ptr == str.data() + last + 1;
+}
+
+std::vector<int> parseItemList(const std::string &items)
+{
+    std::vector<int> result;
+    for (const std::string &item : splitList(items)) {
+        int itemId;
+        if (parseNumber(item, itemId)) {
+            result.push_back(itemId);
+        } else {
+            std::cout << "Unknown item ID '" << item << "'\n";
+        }
+    }
+    return result;
+}
+
 std::string genRandomName(Random &rnd)
 {
     switch (rnd.getInt(0, 7)) {
@@ -691,6 +824,39 @@ std::string processSeed(const std::string &baseSeed, Random &rnd)
     return baseSeed.substr(6);
 }
 
+std::vector<std::string>
+parseSeedList(const std::string &seeds, Random &rnd)
+{
+    std::vector<std::string> result;
+    size_t dash = seeds.find('-');
+    if (dash != std::string::npos && dash > 0 &&
+        seeds.find_first_not_of("0123456789 \t-") == std::string::npos) {
+        // Numeric range "A-B", inclusive.
+        constexpr uint64_t maxRangeSize = 1000000;
+        uint64_t first;
+        uint64_t last;
+        if (seeds.find('-', dash + 1) != std::string::npos ||
+            !parseNumber(seeds.substr(0, dash), first) ||
+            !parseNumber(seeds.substr(dash + 1), last)) {
+            std::cout << "Invalid seed range '" << seeds << "'\n";
+        } else if (last < first) {
+            std::cout << "Empty seed range '" << seeds << "'\n";
+        } else if (last - first >= maxRangeSize) {
+            std::cout << "Seed range '" << seeds << "' exceeds "
+                      << maxRangeSize << " seeds\n";
+        } else {
+            for (uint64_t seed = first; seed <= last; ++seed) {
+                result.push_back(std::to_string(seed));
+            }
+        }
+        return result;
+    }
+    for (const std::string &seed : splitList(seeds)) {
+        result.push_back(processSeed(seed, rnd));
+    }
+    return result;
+}
+
 std::string Config::getFilename() const
 {
     std::string filename(name);
@@ -702,28 +868,9 @@ std::string Config::getFilename() const
     return filename;
 }
 
-#define READ_CONF_VALUE(SECTION, KEY, TYPE)                                    \
-    conf.KEY = reader.Get##TYPE(#SECTION, #KEY, conf.KEY)
-
-#define READ_CONF_AREA_VALUE(SECTION, KEY)                                     \
-    conf.KEY =                                                                 \
-        std::sqrt(std::max(reader.GetReal(#SECTION, #KEY, conf.KEY), 0.0))
-
-#define READ_CONF_ORE_TIER(SECTION, KEY, OPT1, OPT2)                           \
-    do {                                                                       \
-        std::string ore(reader.Get(#SECTION, #KEY, "RANDOM"));                 \
-        if (ore == #OPT1) {                                                    \
-            conf.KEY = TileID::OPT1##Ore;                                      \
-        } else if (ore == #OPT2) {                                             \
-            conf.KEY = TileID::OPT2##Ore;                                      \
-        } else if (ore != "RANDOM") {                                          \
-            std::cout << "Unknown " #KEY " '" << ore << "'\n";                 \
-        }                                                                      \
-    } while (0)
-
-Config readConfig(Random &rnd)
+Config getDefaultConfig()
 {
-    Config conf{
+    return {
         "Terra AWG World",
         "RANDOM",
         6400,
@@ -816,7 +963,38 @@ Config readConfig(Random &rnd)
         false, // endlessHalloween
         false, // endlessChristmas
         false, // vampirism
-        true}; // map
+        true,  // map
+        0,     // threads
+        false, // compress
+        ProfileOutput::none,
+        {}, // scanSeeds
+        DungeonSide::any,
+        {},  // scanSpawnBiomes
+        {}}; // scanChestItems
+}
+
+#define READ_CONF_VALUE(SECTION, KEY, TYPE)                                    \
+    conf.KEY = reader.Get##TYPE(#SECTION, #KEY, conf.KEY)
+
+#define READ_CONF_AREA_VALUE(SECTION, KEY)                                     \
+    conf.KEY =                                                                 \
+        std::sqrt(std::max(reader.GetReal(#SECTION, #KEY, conf.KEY), 0.0))
+
+#define READ_CONF_ORE_TIER(SECTION, KEY, OPT1, OPT2)                           \
+    do {                                                                       \
+        std::string ore(reader.Get(#SECTION, #KEY, "RANDOM"));                 \
+        if (ore == #OPT1) {                                                    \
+            conf.KEY = TileID::OPT1##Ore;                                      \
+        } else if (ore == #OPT2) {                                             \
+            conf.KEY = TileID::OPT2##Ore;                                      \
+        } else if (ore != "RANDOM") {                                          \
+            std::cout << "Unknown " #KEY " '" << ore << "'\n";                 \
+        }                                                                      \
+    } while (0)
+
+Config readConfig(Random &rnd)
+{
+    Config conf = getDefaultConfig();
     if (!std::filesystem::exists(confName)) {
         std::ofstream out(confName, std::ios::out);
         out.write(defaultConfigStr, std::strlen(defaultConfigStr));
@@ -925,6 +1103,14 @@ Config readConfig(Random &rnd)
     READ_CONF_VALUE(variation, endlessChristmas, Boolean);
     READ_CONF_VALUE(variation, vampirism, Boolean);
     READ_CONF_VALUE(extra, map, Boolean);
+    READ_CONF_VALUE(extra, threads, Integer);
+    READ_CONF_VALUE(extra, compress, Boolean);
+    conf.profile = parseProfileOutput(reader.Get("extra", "profile", "none"));
+    conf.scanSeeds = parseSeedList(reader.Get("scan", "seeds", ""), rnd);
+    conf.scanDungeonSide =
+        parseDungeonSide(reader.Get("scan", "dungeonSide", "any"));
+    conf.scanSpawnBiomes = parseBiomeList(reader.Get("scan", "spawnBiome", ""));
+    conf.scanChestItems = parseItemList(reader.Get("scan", "chestItems", ""));
     applyPreset(reader.Get("variation", "preset", "none"), conf);
     return conf;
 }
@@ -1,7 +1,9 @@
 #ifndef CONFIG_H
 #define CONFIG_H
 
+#include "ids/Biome.h"
 #include <string>
+#include <vector>
 
 class Random;
 
@@ -23,6 +25,10 @@ enum class SpawnPoint {
 
 enum class BiomeLayout { columns, layers, patches };
 
+enum class ProfileOutput { none, table, json, trace };
+
+enum class DungeonSide { any, left, right };
+
 struct Config {
     std::string name;
     std::string seed;
@@ -117,10 +123,31 @@ struct Config {
     bool endlessChristmas;
     bool vampirism;
     bool map;
+    int threads;
+    bool compress;
+    ProfileOutput profile;
+    /**
+     * Seeds to generate in a single run, saving only worlds that match the
+     * scan criteria. Empty to generate one world from `seed`.
+     */
+    std::vector<std::string> scanSeeds;
+    DungeonSide scanDungeonSide;
+    /**
+     * Accepted biomes at the spawn point. Empty accepts any.
+     */
+    std::vector<Biome> scanSpawnBiomes;
+    /**
+     * Items that must each appear in at least one chest.
+     */
+    std::vector<int> scanChestItems;
 
     std::string getFilename() const;
 };
 
+/**
+ * Built in defaults, before any config file values or preset.
+ */
+Config getDefaultConfig();
 Config readConfig(Random &rnd);
 
 #endif // CONFIG_H
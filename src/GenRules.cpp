@@ -3,6 +3,7 @@
 #include "Cleanup.h"
 #include "Config.h"
 #include "Random.h"
+#include "StepProfiler.h"
 #include "World.h"
 #include "biomes/Aether.h"
 #include "biomes/AshenField.h"
@@ -74,7 +75,10 @@
 #include "structures/hiveQueen/Temple.h"
 #include "structures/sunken/Flood.h"
 #include "structures/tundra/Glaciation.h"
-#include <ranges>
+#include "vendor/frozen/map.h"
+#include <algorithm>
+#include <cassert>
+#include <map>
 #include <set>
 
 enum class Step {
@@ -173,6 +177,94 @@ enum class Step {
 
 namespace
 {
+#define STEP_NAME(step) {Step::step, #step}
+
+constexpr auto stepNames = frozen::make_map<Step, std::string_view>({
+    STEP_NAME(planBiomes),
+    STEP_NAME(initNoise),
+    STEP_NAME(genWorldBase),
+    STEP_NAME(genOceans),
+    STEP_NAME(genBasins),
+    STEP_NAME(genCloud),
+    STEP_NAME(genMarbleCave),
+    STEP_NAME(genJungle),
+    STEP_NAME(genForest),
+    STEP_NAME(genAshenField),
+    STEP_NAME(genUnderworld),
+    STEP_NAME(genGlowingMushroom),
+    STEP_NAME(genGraniteCave),
+    STEP_NAME(genHive),
+    STEP_NAME(genAether),
+    STEP_NAME(genCrimson),
+    STEP_NAME(genCorruption),
+    STEP_NAME(applyQueuedEvil),
+    STEP_NAME(genMeteorite),
+    STEP_NAME(genAsteroidField),
+    STEP_NAME(genGemCave),
+    STEP_NAME(genSpiderNest),
+    STEP_NAME(genGlowingMoss),
+    STEP_NAME(genGemGrove),
+    STEP_NAME(applyPostBiome),
+    STEP_NAME(genDungeon),
+    STEP_NAME(genTemple),
+    STEP_NAME(genCavernSpawn),
+    STEP_NAME(genPyramid),
+    STEP_NAME(genDesertTomb),
+    STEP_NAME(genBuriedBoat),
+    STEP_NAME(genSpiderHall),
+    STEP_NAME(genRuins),
+    STEP_NAME(genTorchArena),
+    STEP_NAME(genLake),
+    STEP_NAME(genStarterHome),
+    STEP_NAME(genIgloo),
+    STEP_NAME(genMushroomCabin),
+    STEP_NAME(genOceanWreck),
+    STEP_NAME(genTreasure),
+    STEP_NAME(genPlants),
+    STEP_NAME(genTraps),
+    STEP_NAME(genTracks),
+    STEP_NAME(smoothSurfaces),
+    STEP_NAME(finalizeWalls),
+    STEP_NAME(genVines),
+    STEP_NAME(genGrasses),
+    STEP_NAME(genWebs),
+    STEP_NAME(genGlobalEcho),
+    STEP_NAME(genGlobalOutline),
+    STEP_NAME(swapResources),
+    STEP_NAME(genSecondaryCrimson),
+    STEP_NAME(genSecondaryCorruption),
+    STEP_NAME(genShatteredLand),
+    STEP_NAME(genChasms),
+    STEP_NAME(genFlood),
+    STEP_NAME(genGlaciation),
+    STEP_NAME(genHardmodeOres),
+    STEP_NAME(genHallow),
+    STEP_NAME(applyHardmodeLoot),
+    STEP_NAME(initBiomeNoise),
+    STEP_NAME(genWorldBasePatches),
+    STEP_NAME(genAsteroidFieldCelebration),
+    STEP_NAME(genWorldBaseHiveQueen),
+    STEP_NAME(genMarbleCaveHiveQueen),
+    STEP_NAME(genGlowingMushroomHiveQueen),
+    STEP_NAME(genGraniteCaveHiveQueen),
+    STEP_NAME(genHiveHiveQueen),
+    STEP_NAME(genAetherHiveQueen),
+    STEP_NAME(genAsteroidFieldHiveQueen),
+    STEP_NAME(genGlowingMossHiveQueen),
+    STEP_NAME(genGemGroveHiveQueen),
+    STEP_NAME(genTempleHiveQueen),
+    STEP_NAME(genGlobalHive),
+    STEP_NAME(applyDontDigUpLoot),
+    STEP_NAME(terrainGlitch),
+    STEP_NAME(randomizeLoot),
+    STEP_NAME(genTeleporters),
+});
+
+#undef STEP_NAME
+
+// Steps run one at a time, in order. The steps that touch disjoint regions,
+// such as most structures, take around a millisecond or less each, so running
+// them side by side would save nothing; costly steps parallelize internally.
 constexpr std::array baseBiomeRules{
     Step::planBiomes,
     Step::initNoise,
@@ -272,7 +364,20 @@ constexpr std::array hiveQueenBiomeRules{
         step(world);                                                           \
         break;
 
-void doGenStep(Step step, LocationBins &locations, Random &rnd, World &world)
+/**
+ * Each step draws from its own stream, so adding, removing, or reordering
+ * steps leaves other steps unchanged. Streams are forked in step order, from
+ * the generating thread, as forking reads state initNoise writes.
+ */
+Random forkStepStream(const Random &rnd, Step step)
+{
+    return rnd.fork(stepNames.at(step));
+}
+
+/**
+ * Run a step on its own stream (see forkStepStream()).
+ */
+void doGenStep(Step step, LocationBins &locations, Random rnd, World &world)
 {
     switch (step) {
     case Step::planBiomes:
@@ -374,7 +479,39 @@ void doGenStep(Step step, LocationBins &locations, Random &rnd, World &world)
     }
 }
 
-void doWorldGen(Random &rnd, World &world)
+/**
+ * Group checks by the step they follow. Checks for known steps not in the
+ * list are keyed on the final step.
+ */
+std::map<Step, std::vector<const StepCheck *>> resolveChecks(
+    const std::vector<Step> &steps,
+    const std::vector<StepCheck> &checks)
+{
+    std::map<Step, std::vector<const StepCheck *>> resolved;
+    for (const StepCheck &check : checks) {
+        auto itr = std::find_if(
+            stepNames.begin(),
+            stepNames.end(),
+            [&check](const auto &entry) {
+                return entry.second == check.step;
+            });
+        // Checks are built in code, so a misspelled step is a bug; falling
+        // back to the final step would silently drop the early exit.
+        assert(itr != stepNames.end() || check.step.empty());
+        Step step = steps.back();
+        if (itr != stepNames.end() &&
+            std::find(steps.begin(), steps.end(), itr->first) != steps.end()) {
+            step = itr->first;
+        }
+        resolved[step].push_back(&check);
+    }
+    return resolved;
+}
+
+bool doWorldGen(
+    Random &rnd,
+    World &world,
+    const std::vector<StepCheck> &checks)
 {
     std::set<Step> excludes;
     excludes.insert(world.isCrimson ? Step::genCorruption : Step::genCrimson);
@@ -467,9 +604,44 @@ void doWorldGen(Random &rnd, World &world)
         steps.end(),
         baseStructureRules.begin(),
         baseStructureRules.end());
-    for (Step step : steps | std::views::filter([&excludes](Step s) {
-                         return !excludes.contains(s);
-                     })) {
-        doGenStep(step, locations, rnd, world);
+    std::erase_if(steps, [&excludes](Step s) { return excludes.contains(s); });
+    auto stepChecks = resolveChecks(steps, checks);
+    auto passesChecks = [&stepChecks, &world](Step step) {
+        auto itr = stepChecks.find(step);
+        return itr == stepChecks.end() ||
+               std::all_of(
+                   itr->second.begin(),
+                   itr->second.end(),
+                   [&world](const StepCheck *check) {
+                       return check->passes(world);
+                   });
+    };
+    if (world.conf.profile != ProfileOutput::none) {
+        StepProfiler profiler(world);
+        bool passed = true;
+        for (Step step : steps) {
+            profiler.beginStep();
+            doGenStep(step, locations, forkStepStream(rnd, step), world);
+            profiler.endStep(std::string{stepNames.at(step)});
+            if (!passesChecks(step)) {
+                passed = false;
+                break;
+            }
+        }
+        profiler.printTable();
+        std::string filename = world.conf.getFilename() + "-profile.json";
+        if (world.conf.profile == ProfileOutput::json) {
+            profiler.saveJson(filename);
+        } else if (world.conf.profile == ProfileOutput::trace) {
+            profiler.saveTrace(filename);
+        }
+        return passed;
+    }
+    for (Step step : steps) {
+        doGenStep(step, locations, forkStepStream(rnd, step), world);
+        if (!passesChecks(step)) {
+            return false;
+        }
     }
+    return true;
 }
@@ -1,9 +1,31 @@
 #ifndef GENRULES_H
 #define GENRULES_H
 
+#include <functional>
+#include <string>
+#include <vector>
+
 class Random;
 class World;
 
-void doWorldGen(Random &rnd, World &world);
+/**
+ * Predicate checked once the named generation step completes (step names match
+ * profiler output, and must name a known step). Checks for steps that do not
+ * run in this world, or with an empty step name, are checked after the final
+ * step.
+ */
+struct StepCheck {
+    std::string step;
+    std::function<bool(World &)> passes;
+};
+
+/**
+ * Generate the world. Returns false, leaving the world partially generated,
+ * as soon as any check fails.
+ */
+bool doWorldGen(
+    Random &rnd,
+    World &world,
+    const std::vector<StepCheck> &checks = {});
 
 #endif // GENRULES_H
@@ -0,0 +1,190 @@
+#include "Generator.h"
+
+#include "WorldFile.h"
+#include "Writer.h"
+#include "ids/TileID.h"
+#include <algorithm>
+#include <sstream>
+
+namespace
+{
+
+/**
+ * Resolve per-world random choices, and apply secret seed adjustments to the
+ * config.
+ */
+void applyVariations(Config &conf, Random &rnd, World &world)
+{
+    world.isCrimson = conf.evil == EvilBiome::random
+                          ? rnd.getBool()
+                          : conf.evil == EvilBiome::crimson;
+    world.copperVariant = conf.oreT0 == -1
+                              ? rnd.select({TileID::copperOre, TileID::tinOre})
+                              : conf.oreT0;
+    world.ironVariant = conf.oreT1 == -1
+                            ? rnd.select({TileID::ironOre, TileID::leadOre})
+                            : conf.oreT1;
+    world.silverVariant =
+        conf.oreT2 == -1 ? rnd.select({TileID::silverOre, TileID::tungstenOre})
+                         : conf.oreT2;
+    world.goldVariant = conf.oreT3 == -1
+                            ? rnd.select({TileID::goldOre, TileID::platinumOre})
+                            : conf.oreT3;
+    if (conf.doubleTrouble) {
+        conf.bothEvils = true;
+        conf.allOres = true;
+    }
+    if (conf.hardmode) {
+        world.cobaltVariant =
+            conf.oreT4 == -1
+                ? rnd.select({TileID::cobaltOre, TileID::palladiumOre})
+                : conf.oreT4;
+        world.mythrilVariant =
+            conf.oreT5 == -1
+                ? rnd.select({TileID::mythrilOre, TileID::orichalcumOre})
+                : conf.oreT5;
+        world.adamantiteVariant =
+            conf.oreT6 == -1
+                ? rnd.select({TileID::adamantiteOre, TileID::titaniumOre})
+                : conf.oreT6;
+    } else {
+        world.cobaltVariant = TileID::empty;
+        world.mythrilVariant = TileID::empty;
+        world.adamantiteVariant = TileID::empty;
+    }
+    if (conf.aether == AetherBiome::random) {
+        conf.aether = rnd.select(
+            {AetherBiome::rift, AetherBiome::crystalline, AetherBiome::grove});
+    }
+    if (conf.tundra) {
+        conf.patchesTemperature -= 0.5;
+        conf.snowSize *= 1.95;
+        conf.jungleSize *= 0.75;
+        conf.surfaceAmplitude *= 1.25;
+    }
+    if (conf.celebration) {
+        if (conf.spawn == SpawnPoint::normal && !conf.dontDigUp) {
+            conf.spawn = SpawnPoint::ocean;
+        }
+        conf.pots *= 1.6;
+        conf.chests *= 1.1;
+        conf.gems *= 1.15;
+        conf.trees *= 1.1;
+        conf.livingTrees *= 1.5;
+        conf.rollerCoasterChance += 1;
+        conf.minecartTracks *= 1.1;
+        conf.minecartLength *= 1.35;
+    }
+    if (conf.hiveQueen) {
+        conf.hiveQueenBorderWidth =
+            std::clamp(conf.hiveQueenBorderWidth, 2, 25);
+        if (conf.biomes == BiomeLayout::columns) {
+            conf.jungleSize *= 2;
+        } else if (conf.biomes == BiomeLayout::layers) {
+            conf.jungleSize *= 1.35;
+        }
+    } else if (conf.biomes == BiomeLayout::layers) {
+        conf.graniteFreq *= 2;
+        conf.graniteSize *= 0.7071;
+        conf.marbleFreq *= 2;
+        conf.marbleSize *= 0.7071;
+    }
+    if (conf.forTheWorthy) {
+        conf.spiderNestFreq *= 2.5;
+        conf.graniteFreq *= 1.7;
+        conf.marbleFreq *= 1.85;
+        conf.glowingMushroomFreq *= 1.5;
+        conf.glowingMushroomSize *= 1.26;
+        conf.templeSize *= 1.4;
+        conf.glowingMossSize *= 1.225;
+        conf.evilSize *= 1.58;
+    }
+    if (conf.dontDigUp) {
+        conf.ascent = true;
+        conf.gems *= 0.65;
+        conf.evilSize *= 1.5;
+    }
+    if (conf.ascent) {
+        if (conf.spawn == SpawnPoint::normal) {
+            conf.spawn = SpawnPoint::underworld;
+        }
+        conf.minecartTracks *= 1.5;
+    }
+    if (conf.glitched) {
+        conf.clouds *= 1.8;
+        conf.lootRandomizer += 2.5;
+        conf.minecartTracks *= 1.1;
+    }
+    if (conf.spawn == SpawnPoint::normal) {
+        conf.spawn = SpawnPoint::surface;
+    }
+}
+
+/**
+ * Initial world file buffer size. Tiles typically compress to well under a
+ * byte each.
+ */
+size_t worldFileCapacity(World &world)
+{
+    return world.getWidth() * world.getHeight() / 2;
+}
+
+/**
+ * Buffer the world file. Serialization draws from a copy of the world's
+ * random stream, so repeated calls produce the same file.
+ */
+void bufferWorldFile(Writer &w, GeneratedWorld &gen)
+{
+    Random rnd = gen.rnd;
+    putWorldFile(w, gen.conf, rnd, gen.world);
+}
+
+} // namespace
+
+GeneratedWorld::GeneratedWorld(const Config &c) : conf(c), world(conf)
+{
+    rnd.setSeed(conf.seed);
+}
+
+std::unique_ptr<GeneratedWorld>
+generateWorld(const Config &conf, const std::vector<StepCheck> &checks)
+{
+    auto gen = std::make_unique<GeneratedWorld>(conf);
+    applyVariations(gen->conf, gen->rnd, gen->world);
+    if (!doWorldGen(gen->rnd, gen->world, checks)) {
+        return nullptr;
+    }
+    if (gen->conf.zenith) {
+        gen->conf.celebration = true;
+        gen->conf.doubleTrouble = true;
+        gen->conf.forTheWorthy = true;
+        gen->conf.hiveQueen = true;
+        gen->conf.dontDigUp = true;
+        gen->conf.theConstant = true;
+    }
+    return gen;
+}
+
+void serializeWorld(GeneratedWorld &gen, std::ostream &out)
+{
+    Writer w("", worldFileCapacity(gen.world), gen.conf.compress);
+    bufferWorldFile(w, gen);
+    w.writeTo(out);
+}
+
+std::string serializeWorld(GeneratedWorld &gen)
+{
+    std::ostringstream out;
+    serializeWorld(gen, out);
+    return std::move(out).str();
+}
+
+bool saveWorld(GeneratedWorld &gen)
+{
+    Writer w(
+        gen.conf.getFilename() + (gen.conf.compress ? ".wld.gz" : ".wld"),
+        worldFileCapacity(gen.world),
+        gen.conf.compress);
+    bufferWorldFile(w, gen);
+    return w.flush();
+}
@@ -0,0 +1,54 @@
+#ifndef GENERATOR_H
+#define GENERATOR_H
+
+#include "Config.h"
+#include "GenRules.h"
+#include "Random.h"
+#include "World.h"
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * A generated world, with the config and random stream it was generated
+ * from. The world refers to the config, so neither may move.
+ */
+struct GeneratedWorld {
+    Config conf;
+    Random rnd;
+    World world;
+
+    GeneratedWorld(const Config &c);
+
+    GeneratedWorld(const GeneratedWorld &) = delete;
+    GeneratedWorld &operator=(const GeneratedWorld &) = delete;
+};
+
+/**
+ * Generate a world from conf, seeded by conf.seed. Returns nullptr if any
+ * check fails (see doWorldGen()).
+ *
+ * Worker threads come from the process wide ThreadPool, and celebration loot
+ * prefixes are process wide: call PrefixSet::initCelebration() once, before
+ * generating, in processes that generate celebration worlds.
+ */
+std::unique_ptr<GeneratedWorld>
+generateWorld(const Config &conf, const std::vector<StepCheck> &checks = {});
+
+/**
+ * Write the world file, gzip compressed if conf.compress is set. Does not
+ * modify the world; repeated calls produce the same file (apart from
+ * timestamps).
+ */
+void serializeWorld(GeneratedWorld &gen, std::ostream &out);
+std::string serializeWorld(GeneratedWorld &gen);
+
+/**
+ * Save the world file to the working directory, named from the config.
+ *
+ * @return False if the file could not be written.
+ */
+bool saveWorld(GeneratedWorld &gen);
+
+#endif // GENERATOR_H
@@ -0,0 +1,421 @@
+#include "Gzip.h"
+
+#include "vendor/fpng.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <queue>
+
+namespace
+{
+
+constexpr size_t windowSize = 1 << 15;
+constexpr size_t minMatch = 3;
+constexpr size_t maxMatch = 258;
+constexpr int hashBits = 15;
+constexpr int maxChain = 32;
+constexpr size_t niceMatch = 128;
+constexpr size_t blockSymbols = 1 << 15;
+constexpr size_t inputChunk = 1 << 18;
+constexpr size_t outputChunk = 1 << 16;
+
+constexpr std::array<uint16_t, 29> lengthBase{
+    3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+    31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+constexpr std::array<uint8_t, 29> lengthExtra{
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+    2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+constexpr std::array<uint16_t, 30> distBase{
+    1,    2,    3,    4,    5,    7,     9,     13,    17,  25,
+    33,   49,   65,   97,   129,  193,   257,   385,   513, 769,
+    1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+constexpr std::array<uint8_t, 30> distExtra{
+    0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,  6,
+    6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+// Transmission order of code length code lengths.
+constexpr std::array<uint8_t, 19> codeLengthOrder{
+    16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+template <size_t N>
+int findCode(const std::array<uint16_t, N> &bases, size_t val)
+{
+    return std::upper_bound(bases.begin(), bases.end(), val) - bases.begin() -
+           1;
+}
+
+/**
+ * Length of the common prefix of a and b, up to limit bytes.
+ */
+size_t matchLength(const uint8_t *a, const uint8_t *b, size_t limit)
+{
+    size_t len = 0;
+    if constexpr (std::endian::native == std::endian::little) {
+        for (; len + 8 <= limit; len += 8) {
+            uint64_t wordA;
+            uint64_t wordB;
+            std::memcpy(&wordA, a + len, 8);
+            std::memcpy(&wordB, b + len, 8);
+            if (wordA != wordB) {
+                return len + std::countr_zero(wordA ^ wordB) / 8;
+            }
+        }
+    }
+    while (len < limit && a[len] == b[len]) {
+        ++len;
+    }
+    return len;
+}
+
+/**
+ * Huffman code lengths for the given symbol frequencies, limited to maxBits.
+ */
+std::vector<uint8_t>
+huffmanLengths(const uint32_t *freq, size_t numSyms, int maxBits)
+{
+    std::vector<uint32_t> weights(freq, freq + numSyms);
+    // Decoders require at least two codes to form a complete tree.
+    int used = std::count_if(weights.begin(), weights.end(), [](uint32_t w) {
+        return w > 0;
+    });
+    for (size_t i = 0; used < 2 && i < numSyms; ++i) {
+        if (weights[i] == 0) {
+            weights[i] = 1;
+            ++used;
+        }
+    }
+    while (true) {
+        struct Node {
+            uint64_t weight;
+            int parent;
+        };
+        std::vector<Node> nodes;
+        std::vector<int> leafNode(numSyms, -1);
+        using Entry = std::pair<uint64_t, int>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<>> queue;
+        for (size_t i = 0; i < numSyms; ++i) {
+            if (weights[i] > 0) {
+                leafNode[i] = nodes.size();
+                queue.emplace(weights[i], nodes.size());
+                nodes.push_back({weights[i], -1});
+            }
+        }
+        while (queue.size() > 1) {
+            auto [weightA, a] = queue.top();
+            queue.pop();
+            auto [weightB, b] = queue.top();
+            queue.pop();
+            int parent = nodes.size();
+            nodes[a].parent = parent;
+            nodes[b].parent = parent;
+            nodes.push_back({weightA + weightB, -1});
+            queue.emplace(weightA + weightB, parent);
+        }
+        // Parents always follow their children, so walk back from the root.
+        std::vector<int> depth(nodes.size(), 0);
+        for (int i = nodes.size() - 2; i >= 0; --i) {
+            depth[i] = depth[nodes[i].parent] + 1;
+        }
+        std::vector<uint8_t> lengths(numSyms, 0);
+        int longest = 0;
+        for (size_t i = 0; i < numSyms; ++i) {
+            if (leafNode[i] >= 0) {
+                lengths[i] = depth[leafNode[i]];
+                longest = std::max<int>(longest, lengths[i]);
+            }
+        }
+        if (longest <= maxBits) {
+            return lengths;
+        }
+        // Flatten the distribution and retry.
+        for (auto &weight : weights) {
+            weight = (weight + 1) / 2;
+        }
+    }
+}
+
+/**
+ * Canonical codes for the given lengths, bit reversed for LSB first output.
+ */
+std::vector<uint16_t> canonicalCodes(const std::vector<uint8_t> &lengths)
+{
+    std::array<uint16_t, 16> lengthCount{};
+    for (auto length : lengths) {
+        if (length > 0) {
+            ++lengthCount[length];
+        }
+    }
+    std::array<uint16_t, 16> nextCode{};
+    uint16_t code = 0;
+    for (int bits = 1; bits < 16; ++bits) {
+        code = (code + lengthCount[bits - 1]) << 1;
+        nextCode[bits] = code;
+    }
+    std::vector<uint16_t> codes(lengths.size(), 0);
+    for (size_t i = 0; i < lengths.size(); ++i) {
+        int length = lengths[i];
+        if (length == 0) {
+            continue;
+        }
+        uint16_t val = nextCode[length]++;
+        uint16_t reversed = 0;
+        for (int bit = 0; bit < length; ++bit) {
+            reversed = (reversed << 1) | ((val >> bit) & 1);
+        }
+        codes[i] = reversed;
+    }
+    return codes;
+}
+
+} // namespace
+
+GzipWriter::GzipWriter(std::ostream &out)
+    : out(out), inputBase(0), cursor(0), head(1 << hashBits, 0),
+      prev(windowSize, 0), bitBuf(0), bitCount(0), crc(fpng::FPNG_CRC32_INIT),
+      totalIn(0)
+{
+    fpng::fpng_init();
+    // Magic, deflate method, no flags, no timestamp, unknown OS.
+    output = {0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 0xff};
+}
+
+void GzipWriter::write(const char *data, size_t len)
+{
+    crc = fpng::fpng_crc32(data, len, crc);
+    totalIn += len;
+    // Feed large writes in pieces, to bound the buffered input.
+    while (len > 0) {
+        size_t piece = std::min(len, inputChunk);
+        input.insert(input.end(), data, data + piece);
+        data += piece;
+        len -= piece;
+        if (inputBase + input.size() - cursor >= inputChunk) {
+            compress(false);
+        }
+    }
+}
+
+void GzipWriter::finish()
+{
+    compress(true);
+    emitBlock(true);
+    flushBits();
+    for (uint32_t val : {crc, static_cast<uint32_t>(totalIn)}) {
+        for (int i = 0; i < 4; ++i) {
+            output.push_back(0xff & (val >> (8 * i)));
+        }
+    }
+    flushOutput();
+}
+
+void GzipWriter::insertHash(size_t pos)
+{
+    if (pos + minMatch > inputBase + input.size()) {
+        return;
+    }
+    const uint8_t *data = input.data() + (pos - inputBase);
+    uint32_t key = data[0] | data[1] << 8 | data[2] << 16;
+    uint32_t hash = (key * 2654435761u) >> (32 - hashBits);
+    prev[pos & (windowSize - 1)] = head[hash];
+    head[hash] = pos + 1;
+}
+
+void GzipWriter::compress(bool finishing)
+{
+    size_t end = inputBase + input.size();
+    if (!finishing && end < cursor + maxMatch) {
+        return;
+    }
+    // More input may follow, so leave room for a full length match.
+    size_t limit = finishing ? end : end - maxMatch;
+    while (cursor < limit) {
+        const uint8_t *cur = input.data() + (cursor - inputBase);
+        size_t available = std::min(maxMatch, end - cursor);
+        size_t bestLen = 0;
+        size_t bestDist = 0;
+        if (available >= minMatch) {
+            uint32_t key = cur[0] | cur[1] << 8 | cur[2] << 16;
+            size_t candidate = head[(key * 2654435761u) >> (32 - hashBits)];
+            for (int chain = 0; candidate != 0 && chain < maxChain;
+                 ++chain) {
+                size_t pos = candidate - 1;
+                if (cursor - pos > windowSize) {
+                    break;
+                }
+                const uint8_t *ref = input.data() + (pos - inputBase);
+                if (ref[bestLen] == cur[bestLen]) {
+                    size_t len = matchLength(ref, cur, available);
+                    if (len > bestLen) {
+                        bestLen = len;
+                        bestDist = cursor - pos;
+                        if (len >= niceMatch || len == available) {
+                            break;
+                        }
+                    }
+                }
+                candidate = prev[pos & (windowSize - 1)];
+            }
+        }
+        if (bestLen >= minMatch) {
+            symbols.push_back(
+                {static_cast<uint16_t>(bestLen),
+                 static_cast<uint16_t>(bestDist)});
+            for (size_t i = 0; i < bestLen; ++i) {
+                insertHash(cursor + i);
+            }
+            cursor += bestLen;
+        } else {
+            symbols.push_back({cur[0], 0});
+            insertHash(cursor);
+            ++cursor;
+        }
+        if (symbols.size() >= blockSymbols) {
+            emitBlock(false);
+        }
+    }
+    // Drop input that has left the window.
+    if (cursor > inputBase + 2 * windowSize) {
+        size_t drop = cursor - windowSize - inputBase;
+        input.erase(input.begin(), input.begin() + drop);
+        inputBase += drop;
+    }
+}
+
+void GzipWriter::emitBlock(bool final)
+{
+    std::array<uint32_t, 286> litLenFreq{};
+    std::array<uint32_t, 30> distFreq{};
+    for (auto [litLen, dist] : symbols) {
+        if (dist == 0) {
+            ++litLenFreq[litLen];
+        } else {
+            ++litLenFreq[257 + findCode(lengthBase, litLen)];
+            ++distFreq[findCode(distBase, dist)];
+        }
+    }
+    ++litLenFreq[256]; // End of block.
+    auto litLenLengths =
+        huffmanLengths(litLenFreq.data(), litLenFreq.size(), 15);
+    auto distLengths = huffmanLengths(distFreq.data(), distFreq.size(), 15);
+    auto litLenCodes = canonicalCodes(litLenLengths);
+    auto distCodes = canonicalCodes(distLengths);
+
+    int numLitLen = litLenLengths.size();
+    while (numLitLen > 257 && litLenLengths[numLitLen - 1] == 0) {
+        --numLitLen;
+    }
+    int numDist = distLengths.size();
+    while (numDist > 1 && distLengths[numDist - 1] == 0) {
+        --numDist;
+    }
+
+    // Run length encode the combined code lengths.
+    std::vector<uint8_t> lengths(
+        litLenLengths.begin(),
+        litLenLengths.begin() + numLitLen);
+    lengths.insert(
+        lengths.end(),
+        distLengths.begin(),
+        distLengths.begin() + numDist);
+    std::vector<std::pair<uint8_t, uint8_t>> runs; // Symbol, extra bits.
+    for (size_t i = 0; i < lengths.size();) {
+        uint8_t length = lengths[i];
+        size_t run = 1;
+        while (i + run < lengths.size() && lengths[i + run] == length) {
+            ++run;
+        }
+        i += run;
+        if (length == 0) {
+            for (; run >= 11; run -= std::min<size_t>(run, 138)) {
+                runs.emplace_back(18, std::min<size_t>(run, 138) - 11);
+            }
+            if (run >= 3) {
+                runs.emplace_back(17, run - 3);
+                run = 0;
+            }
+        } else {
+            runs.emplace_back(length, 0);
+            for (--run; run >= 3; run -= std::min<size_t>(run, 6)) {
+                runs.emplace_back(16, std::min<size_t>(run, 6) - 3);
+            }
+        }
+        for (; run > 0; --run) {
+            runs.emplace_back(length, 0);
+        }
+    }
+    std::array<uint32_t, 19> codeLengthFreq{};
+    for (auto [sym, extra] : runs) {
+        ++codeLengthFreq[sym];
+    }
+    auto codeLengthLengths =
+        huffmanLengths(codeLengthFreq.data(), codeLengthFreq.size(), 7);
+    auto codeLengthCodes = canonicalCodes(codeLengthLengths);
+    int numCodeLength = codeLengthOrder.size();
+    while (numCodeLength > 4 &&
+           codeLengthLengths[codeLengthOrder[numCodeLength - 1]] == 0) {
+        --numCodeLength;
+    }
+
+    putBits(final ? 1 : 0, 1);
+    putBits(2, 2); // Dynamic Huffman codes.
+    putBits(numLitLen - 257, 5);
+    putBits(numDist - 1, 5);
+    putBits(numCodeLength - 4, 4);
+    for (int i = 0; i < numCodeLength; ++i) {
+        putBits(codeLengthLengths[codeLengthOrder[i]], 3);
+    }
+    for (auto [sym, extra] : runs) {
+        putBits(codeLengthCodes[sym], codeLengthLengths[sym]);
+        if (sym == 16) {
+            putBits(extra, 2);
+        } else if (sym == 17) {
+            putBits(extra, 3);
+        } else if (sym == 18) {
+            putBits(extra, 7);
+        }
+    }
+
+    for (auto [litLen, dist] : symbols) {
+        if (dist == 0) {
+            putBits(litLenCodes[litLen], litLenLengths[litLen]);
+            continue;
+        }
+        int lengthCode = findCode(lengthBase, litLen);
+        putBits(litLenCodes[257 + lengthCode], litLenLengths[257 + lengthCode]);
+        putBits(litLen - lengthBase[lengthCode], lengthExtra[lengthCode]);
+        int distCode = findCode(distBase, dist);
+        putBits(distCodes[distCode], distLengths[distCode]);
+        putBits(dist - distBase[distCode], distExtra[distCode]);
+    }
+    putBits(litLenCodes[256], litLenLengths[256]);
+    symbols.clear();
+    if (output.size() >= outputChunk) {
+        flushOutput();
+    }
+}
+
+void GzipWriter::putBits(uint32_t bits, int count)
+{
+    bitBuf |= static_cast<uint64_t>(bits) << bitCount;
+    bitCount += count;
+    while (bitCount >= 8) {
+        output.push_back(0xff & bitBuf);
+        bitBuf >>= 8;
+        bitCount -= 8;
+    }
+}
+
+void GzipWriter::flushBits()
+{
+    if (bitCount > 0) {
+        output.push_back(0xff & bitBuf);
+    }
+    bitBuf = 0;
+    bitCount = 0;
+}
+
+void GzipWriter::flushOutput()
+{
+    out.write(reinterpret_cast<const char *>(output.data()), output.size());
+    output.clear();
+}
@@ -0,0 +1,53 @@
+#ifndef GZIP_H
+#define GZIP_H
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+/**
+ * Streaming gzip (deflate) compressor.
+ *
+ * Input is matched against a 32KiB sliding window with hash chains, and
+ * emitted as dynamic Huffman blocks.
+ */
+class GzipWriter
+{
+private:
+    struct Symbol {
+        uint16_t litLen; // Literal byte, or match length.
+        uint16_t dist;   // Match distance, or 0 for a literal.
+    };
+
+    std::ostream &out;
+    std::vector<uint8_t> input;
+    size_t inputBase; // Stream offset of input[0].
+    size_t cursor;    // Stream offset of the next byte to match.
+    std::vector<size_t> head;
+    std::vector<size_t> prev;
+    std::vector<Symbol> symbols;
+    std::vector<uint8_t> output;
+    uint64_t bitBuf;
+    int bitCount;
+    uint32_t crc;
+    size_t totalIn;
+
+    void compress(bool finishing);
+    void insertHash(size_t pos);
+    void emitBlock(bool final);
+    void putBits(uint32_t bits, int count);
+    void flushBits();
+    void flushOutput();
+
+public:
+    GzipWriter(std::ostream &out);
+
+    void write(const char *data, size_t len);
+
+    /**
+     * Compress remaining input and write the gzip trailer.
+     */
+    void finish();
+};
+
+#endif // GZIP_H
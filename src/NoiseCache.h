@@ -0,0 +1,140 @@
+#ifndef NOISECACHE_H
+#define NOISECACHE_H
+
+#include "Util.h"
+#include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+/**
+ * Grid of noise samples, computed in square blocks on first access.
+ *
+ * Lookups are thread safe; concurrent first accesses to a block compute it
+ * once.
+ *
+ * @tparam Channels Number of samples stored per location.
+ */
+template <size_t Channels> class NoiseCache
+{
+public:
+    static constexpr int blockSize = 64;
+
+    using Sample = std::array<double, Channels>;
+    /**
+     * Computes the samples for a single location.
+     */
+    using Sampler = std::function<void(int x, int y, Sample &out)>;
+    /**
+     * Computes the samples for count (at most blockSize) consecutive
+     * locations in a column, starting from (x, y). Channel c of location
+     * (x, y + i) is written to out[c][i].
+     */
+    using ColumnSampler = std::function<void(
+        int x,
+        int y,
+        int count,
+        const std::array<double *, Channels> &out)>;
+
+private:
+    struct Block {
+        std::array<std::array<double, blockSize * blockSize>, Channels> data;
+    };
+
+    int width;
+    int height;
+    int blocksHigh;
+    ColumnSampler sampler;
+    std::unique_ptr<std::unique_ptr<Block>[]> storage;
+    std::unique_ptr<std::atomic<const Block *>[]> ready;
+    std::unique_ptr<std::mutex[]> locks;
+
+    const Block *fillBlock(int index)
+    {
+        std::lock_guard lock(locks[index]);
+        const Block *block = ready[index].load(std::memory_order_acquire);
+        if (block != nullptr) {
+            return block;
+        }
+        auto result = std::make_unique<Block>();
+        int minX = blockSize * (index / blocksHigh);
+        int minY = blockSize * (index % blocksHigh);
+        int maxX = std::min(minX + blockSize, width);
+        int maxY = std::min(minY + blockSize, height);
+        for (int x = minX; x < maxX; ++x) {
+            std::array<double *, Channels> out;
+            for (size_t c = 0; c < Channels; ++c) {
+                out[c] = result->data[c].data() + blockSize * (x - minX);
+            }
+            sampler(x, minY, maxY - minY, out);
+        }
+        block = result.get();
+        storage[index] = std::move(result);
+        ready[index].store(block, std::memory_order_release);
+        return block;
+    }
+
+public:
+    NoiseCache(int w, int h, Sampler s)
+        : NoiseCache(
+              w,
+              h,
+              [s = std::move(s)](
+                  int x,
+                  int y,
+                  int count,
+                  const std::array<double *, Channels> &out) {
+                  Sample sample;
+                  for (int i = 0; i < count; ++i) {
+                      s(x, y + i, sample);
+                      for (size_t c = 0; c < Channels; ++c) {
+                          out[c][i] = sample[c];
+                      }
+                  }
+              })
+    {
+    }
+
+    NoiseCache(int w, int h, ColumnSampler s)
+        : width(w), height(h), blocksHigh((h + blockSize - 1) / blockSize),
+          sampler(std::move(s))
+    {
+        int numBlocks = blocksHigh * ((w + blockSize - 1) / blockSize);
+        storage = std::make_unique<std::unique_ptr<Block>[]>(numBlocks);
+        ready = std::make_unique<std::atomic<const Block *>[]>(numBlocks);
+        locks = std::make_unique<std::mutex[]>(numBlocks);
+        for (int i = 0; i < numBlocks; ++i) {
+            ready[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Sample at the specified location. Location must be in bounds.
+     */
+    double get(int x, int y, size_t channel)
+    {
+        int index = blocksHigh * (x / blockSize) + y / blockSize;
+        const Block *block = ready[index].load(std::memory_order_acquire);
+        if (block == nullptr) [[unlikely]] {
+            block = fillBlock(index);
+        }
+        return block->data[channel]
+                          [blockSize * (x % blockSize) + y % blockSize];
+    }
+
+    /**
+     * Compute all remaining blocks, in parallel.
+     */
+    void fillAll()
+    {
+        int numBlocks = blocksHigh * ((width + blockSize - 1) / blockSize);
+        parallelFor(std::views::iota(0, numBlocks), [this](int index) {
+            if (ready[index].load(std::memory_order_acquire) == nullptr) {
+                fillBlock(index);
+            }
+        });
+    }
+};
+
+#endif // NOISECACHE_H
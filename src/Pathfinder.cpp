@@ -1,5 +1,6 @@
 #include "Pathfinder.h"
 
+#include <cstdint>
 #include <set>
 
 namespace detail
@@ -9,6 +10,67 @@ int distHeuristic(const Point &a, const Point &b)
     return 2 * (std::abs(a.x - b.x) + std::abs(a.y - b.y));
 }
 
+SearchNodes::SearchNodes() : slots(1024, -1), slotMask(1023) {}
+
+SearchNodes &SearchNodes::get()
+{
+    thread_local SearchNodes nodes;
+    return nodes;
+}
+
+size_t SearchNodes::getSlot(Point pt) const
+{
+    uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(pt.x)) << 32) |
+                   static_cast<uint32_t>(pt.y);
+    key *= 0x9e3779b97f4a7c15u;
+    size_t slot = (key >> 32) & slotMask;
+    while (slots[slot] != -1 && points[slots[slot]] != pt) {
+        slot = (slot + 1) & slotMask;
+    }
+    return slot;
+}
+
+void SearchNodes::grow()
+{
+    slots.assign(2 * slots.size(), -1);
+    slotMask = slots.size() - 1;
+    for (size_t node = 0; node < points.size(); ++node) {
+        slots[getSlot(points[node])] = node;
+    }
+}
+
+void SearchNodes::clear()
+{
+    // Remove newest first, so earlier nodes along each probe sequence are
+    // still present when looking up later ones.
+    for (auto itr = points.rbegin(); itr != points.rend(); ++itr) {
+        slots[getSlot(*itr)] = -1;
+    }
+    points.clear();
+    costTo.clear();
+    parents.clear();
+    frontier.clear();
+}
+
+bool SearchNodes::contains(Point pt) const
+{
+    return slots[getSlot(pt)] != -1;
+}
+
+int SearchNodes::add(Point pt, int cost, int parent)
+{
+    // Keep load factor at most 1/2, so probe sequences stay short.
+    if (2 * (points.size() + 1) > slots.size()) {
+        grow();
+    }
+    int node = points.size();
+    slots[getSlot(pt)] = node;
+    points.push_back(pt);
+    costTo.push_back(cost);
+    parents.push_back(parent);
+    return node;
+}
+
 void joinPath(std::vector<Point> &path, PathItr segBeg, PathItr segEnd)
 {
     std::set<Point> segCheck{segBeg, segBeg + 50};
@@ -2,28 +2,69 @@
 #define PATHFINDER_H
 
 #include "Point.h"
+#include <algorithm>
 #include <future>
-#include <map>
 #include <numeric>
-#include <queue>
 #include <vector>
 
 namespace detail
 {
 int distHeuristic(const Point &a, const Point &b);
 
-template <typename BoundsCheck>
-std::vector<Point> neighbors(Point pt, BoundsCheck isValid)
+/**
+ * Node bookkeeping for aStarSearch. Nodes are kept in a flat array, found
+ * through an open addressed hash table, and the frontier is a binary heap of
+ * node indices. Buffers are reused between searches.
+ */
+class SearchNodes
 {
-    std::vector<Point> ret;
-    for (Point delta : {Point{1, 0}, {-1, 0}, {0, 1}, {0, -1}}) {
-        Point opt = pt + delta;
-        if (isValid(opt)) {
-            ret.push_back(opt);
-        }
+private:
+    std::vector<Point> points;
+    std::vector<int> costTo;
+    std::vector<int> parents;
+    std::vector<int> slots;
+    size_t slotMask;
+
+    size_t getSlot(Point pt) const;
+    void grow();
+
+public:
+    /**
+     * Frontier entries: estimated total cost, and node index.
+     */
+    std::vector<std::pair<int, int>> frontier;
+
+    SearchNodes();
+
+    /**
+     * Scratch buffers for the calling thread.
+     */
+    static SearchNodes &get();
+
+    void clear();
+
+    bool contains(Point pt) const;
+
+    /**
+     * Add a node not yet present. Returns its index.
+     */
+    int add(Point pt, int cost, int parent);
+
+    Point getPoint(int node) const
+    {
+        return points[node];
     }
-    return ret;
-}
+
+    int getCostTo(int node) const
+    {
+        return costTo[node];
+    }
+
+    int getParent(int node) const
+    {
+        return parents[node];
+    }
+};
 
 /**
  * Approximate pathfind. Resulting path is reversed.
@@ -32,43 +73,38 @@ template <typename NodeCost, typename BoundsCheck>
 std::vector<Point>
 aStarSearch(Point start, Point goal, NodeCost costAt, BoundsCheck isValid)
 {
-    std::map<Point, int> costEst{{start, distHeuristic(start, goal)}};
-    auto costCmp = [&costEst](const Point &a, const Point &b) {
-        auto itrA = costEst.find(a);
-        int costA = itrA == costEst.end() ? std::numeric_limits<int>::max()
-                                          : itrA->second;
-        auto itrB = costEst.find(b);
-        int costB = itrB == costEst.end() ? std::numeric_limits<int>::max()
-                                          : itrB->second;
-        return costA > costB;
+    SearchNodes &nodes = SearchNodes::get();
+    nodes.clear();
+    auto &frontier = nodes.frontier;
+    // Estimates never change once pushed, so ties break as with a
+    // std::priority_queue.
+    auto costCmp = [](const std::pair<int, int> &a,
+                      const std::pair<int, int> &b) {
+        return a.first > b.first;
     };
-    std::priority_queue<Point, std::vector<Point>, decltype(costCmp)> frontier{
-        costCmp};
-    frontier.push(start);
-    std::map<Point, int> exactCostTo{{start, 0}};
-    std::map<Point, Point> parents;
+    frontier.emplace_back(
+        distHeuristic(start, goal),
+        nodes.add(start, 0, -1));
     while (!frontier.empty()) {
-        Point current = frontier.top();
-        if (current == goal) {
+        int current = frontier.front().second;
+        Point currentPt = nodes.getPoint(current);
+        if (currentPt == goal) {
             std::vector<Point> path;
-            while (true) {
-                path.push_back(current);
-                auto itr = parents.find(current);
-                if (itr == parents.end()) {
-                    break;
-                }
-                current = itr->second;
+            for (; current != -1; current = nodes.getParent(current)) {
+                path.push_back(nodes.getPoint(current));
             }
             return path;
         }
-        frontier.pop();
-        for (Point neighbor : neighbors(current, isValid)) {
-            if (!costEst.contains(neighbor)) {
-                int stepCost = exactCostTo[current] + costAt(neighbor);
-                exactCostTo[neighbor] = stepCost;
-                costEst[neighbor] = stepCost + distHeuristic(neighbor, goal);
-                frontier.push(neighbor);
-                parents[neighbor] = current;
+        std::pop_heap(frontier.begin(), frontier.end(), costCmp);
+        frontier.pop_back();
+        for (Point delta : {Point{1, 0}, {-1, 0}, {0, 1}, {0, -1}}) {
+            Point neighbor = currentPt + delta;
+            if (isValid(neighbor) && !nodes.contains(neighbor)) {
+                int stepCost = nodes.getCostTo(current) + costAt(neighbor);
+                frontier.emplace_back(
+                    stepCost + distHeuristic(neighbor, goal),
+                    nodes.add(neighbor, stepCost, current));
+                std::push_heap(frontier.begin(), frontier.end(), costCmp);
             }
         }
     }
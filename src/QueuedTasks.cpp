@@ -3,6 +3,7 @@
 #include "Random.h"
 #include <algorithm>
 #include <cassert>
+#include <string>
 
 void QueuedTasks::addTask(RenderTask &&task)
 {
@@ -14,9 +15,17 @@ void QueuedTasks::runTasks(Random &rnd, World &world)
 {
     assert(!isComplete);
     isComplete = true;
-    std::shuffle(tasks.begin(), tasks.end(), rnd.getPRNG());
-    for (const auto &task : tasks) {
-        task(rnd, world);
+    // Give each task its own stream, keyed by the order tasks were added, so
+    // tasks do not perturb each other.
+    std::vector<std::pair<RenderTask, Random>> keyedTasks;
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        keyedTasks.emplace_back(
+            std::move(tasks[i]),
+            rnd.fork(std::to_string(i)));
     }
     tasks.clear();
+    std::shuffle(keyedTasks.begin(), keyedTasks.end(), rnd.getPRNG());
+    for (auto &[task, taskRnd] : keyedTasks) {
+        task(taskRnd, world);
+    }
 }
@@ -8,7 +8,21 @@
 #include <iostream>
 #include <numbers>
 
-Random::Random() : noiseWidth(0), noiseHeight(0), noiseDeltaX(0), noiseDeltaY(0)
+namespace
+{
+uint64_t hashString(uint64_t hash, std::string_view str)
+{
+    for (auto c : str) {
+        hash ^= c;
+        hash *= 1099511628211;
+    }
+    return hash;
+}
+} // namespace
+
+Random::Random()
+    : shared(std::make_shared<SharedNoise>()), noiseDeltaX(0), noiseDeltaY(0),
+      numPoolSites(0)
 {
     std::string tmpSeed = std::to_string(std::random_device{}());
     tmpSeed += '-';
@@ -22,78 +36,138 @@ Random::Random() : noiseWidth(0), noiseHeight(0), noiseDeltaX(0), noiseDeltaY(0)
 
 void Random::setSeed(const std::string &seed)
 {
-    uint64_t hash = 14695981039346656037u;
-    for (auto c : seed) {
-        hash ^= c;
-        hash *= 1099511628211;
-    }
-    rnd.seed(hash);
+    seedHash = hashString(14695981039346656037u, seed);
+    rnd.seed(seedHash);
+}
+
+Random Random::fork(std::string_view key) const
+{
+    Random child(*this);
+    // Separate the key from the seed, so (seed, key) pairs cannot collide by
+    // shifting characters between them.
+    child.seedHash = hashString(hashString(seedHash, "/"), key);
+    child.rnd.seed(child.seedHash);
+    child.poolState.clear();
+    child.numPoolSites = 0;
+    child.shuffleNoise();
+    return child;
 }
 
 void Random::initNoise(int width, int height, double scale)
 {
     std::cout << "Sampling noise\n";
-    fineNoise.resize(width * height);
-    coarseNoise.resize(width * height);
     std::uniform_int_distribution<int64_t> dist(
         0,
         std::numeric_limits<int64_t>::max());
-    OpenSimplexNoise noise{dist(rnd)};
     double radiusX = scale * width * 0.5 * std::numbers::inv_pi;
     double radiusY = scale * height * 0.5 * std::numbers::inv_pi;
-    parallelFor(
-        std::views::iota(0, width),
-        [width, height, radiusX, radiusY, &noise, this](int x) {
+    // Column samplers share the vertical coordinates, so compute them once.
+    std::vector<double> y1s(height);
+    std::vector<double> y2s(height);
+    for (int y = 0; y < height; ++y) {
+        double tY = 2 * std::numbers::pi * y / height;
+        y1s[y] = radiusY * std::cos(tY);
+        y2s[y] = radiusY * std::sin(tY);
+    }
+    shared->noise = std::make_unique<NoiseCache<2>>(
+        width,
+        height,
+        [width,
+         radiusX,
+         y1s = std::move(y1s),
+         y2s = std::move(y2s),
+         simplex = OpenSimplexNoise{dist(rnd)}](
+            int x,
+            int y,
+            int count,
+            const std::array<double *, 2> &out) mutable {
+            constexpr int maxCount = NoiseCache<2>::blockSize;
             double tX = 2 * std::numbers::pi * x / width;
             double x1 = radiusX * std::cos(tX);
             double x2 = radiusX * std::sin(tX);
-            for (int y = 0; y < height; ++y) {
-                double tY = 2 * std::numbers::pi * y / height;
-                double y1 = radiusY * std::cos(tY);
-                double y2 = radiusY * std::sin(tY);
-                // Seamless looping 2d noise with fractal details.
-                fineNoise[x * height + y] =
-                    noise.Evaluate(x1, x2, y1, y2) +
-                    0.5 * noise.Evaluate(2 * x1, 2 * x2, 2 * y1, 2 * y2) +
-                    0.25 * noise.Evaluate(4 * x1, 4 * x2, 4 * y1, 4 * y2);
-                coarseNoise[x * height + y] =
-                    noise.Evaluate(x1 / 8, x2 / 8, y1 / 8, y2 / 8) +
-                    0.5 * noise.Evaluate(x1 / 4, x2 / 4, y1 / 4, y2 / 4) +
-                    0.25 * noise.Evaluate(x1 / 2, x2 / 2, y1 / 2, y2 / 2) +
-                    0.125 * fineNoise[x * height + y];
+            std::array<double, maxCount> px1{};
+            std::array<double, maxCount> px2{};
+            std::array<double, maxCount> py1{};
+            std::array<double, maxCount> py2{};
+            std::array<double, maxCount> octave{};
+            auto sampleOctave = [&](double factor) {
+                for (int i = 0; i < count; ++i) {
+                    px1[i] = factor * x1;
+                    px2[i] = factor * x2;
+                    py1[i] = factor * y1s[y + i];
+                    py2[i] = factor * y2s[y + i];
+                }
+                simplex.Evaluate(
+                    px1.data(),
+                    px2.data(),
+                    py1.data(),
+                    py2.data(),
+                    octave.data(),
+                    count);
+            };
+            // Seamless looping 2d noise with fractal details. Octaves are
+            // summed in a fixed order to keep results reproducible.
+            double *fine = out[0];
+            double *coarse = out[1];
+            sampleOctave(1);
+            std::copy_n(octave.begin(), count, fine);
+            for (auto [factor, weight] : {std::pair{2.0, 0.5}, {4.0, 0.25}}) {
+                sampleOctave(factor);
+                for (int i = 0; i < count; ++i) {
+                    fine[i] += weight * octave[i];
+                }
+            }
+            sampleOctave(0.125);
+            std::copy_n(octave.begin(), count, coarse);
+            for (auto [factor, weight] :
+                 {std::pair{0.25, 0.5}, {0.5, 0.25}}) {
+                sampleOctave(factor);
+                for (int i = 0; i < count; ++i) {
+                    coarse[i] += weight * octave[i];
+                }
+            }
+            for (int i = 0; i < count; ++i) {
+                coarse[i] += 0.125 * fine[i];
             }
         });
 
-    noiseWidth = width;
-    noiseHeight = height;
-
-    computeBlurNoise();
+    shared->width = width;
+    shared->height = height;
+    shared->blurNoise = std::make_unique<BlurNoise>();
 }
 
-void Random::computeBlurNoise()
+void Random::computeBlurNoise() const
 {
-    std::cout << "Blurring noise\n";
-    blurNoise.resize(coarseNoise.size());
+    NoiseCache<2> &noise = *shared->noise;
+    int width = shared->width;
+    int height = shared->height;
+    // Blurring reads every coarse sample, so compute them all up front, in
+    // parallel.
+    noise.fillAll();
+    std::vector<double> &data = shared->blurNoise->data;
+    data.resize(width * height);
     // Fast approximate Gaussian blur via horizontal/vertical smearing with
     // rolling averages.
-    parallelFor(std::views::iota(0, noiseWidth), [this](int x) {
-        double accu = 0;
-        for (int y = noiseHeight - 40; y < noiseHeight; ++y) {
-            accu = 0.9 * accu + 0.1 * coarseNoise[x * noiseHeight + y];
-        }
-        for (int y = 0; y < noiseHeight; ++y) {
-            accu = 0.9 * accu + 0.1 * coarseNoise[x * noiseHeight + y];
-            blurNoise[x * noiseHeight + y] = accu;
-        }
-    });
-    parallelFor(std::views::iota(0, noiseHeight), [this](int y) {
+    parallelFor(
+        std::views::iota(0, width),
+        [&data, &noise, height](int x) {
+            double accu = 0;
+            for (int y = height - 40; y < height; ++y) {
+                accu = 0.9 * accu + 0.1 * noise.get(x, y, 1);
+            }
+            for (int y = 0; y < height; ++y) {
+                accu = 0.9 * accu + 0.1 * noise.get(x, y, 1);
+                data[x * height + y] = accu;
+            }
+        });
+    parallelFor(std::views::iota(0, height), [&data, width, height](int y) {
         double accu = 0;
-        for (int x = noiseWidth - 40; x < noiseWidth; ++x) {
-            accu = 0.9 * accu + 0.1 * blurNoise[x * noiseHeight + y];
+        for (int x = width - 40; x < width; ++x) {
+            accu = 0.9 * accu + 0.1 * data[x * height + y];
         }
-        for (int x = 0; x < noiseWidth; ++x) {
-            accu = 0.9 * accu + 0.1 * blurNoise[x * noiseHeight + y];
-            blurNoise[x * noiseHeight + y] = accu;
+        for (int x = 0; x < width; ++x) {
+            accu = 0.9 * accu + 0.1 * data[x * height + y];
+            data[x * height + y] = accu;
         }
     });
 }
@@ -101,116 +175,137 @@ void Random::computeBlurNoise()
 void Random::initBiomeNoise(double scale, const Config &conf)
 {
     std::cout << "Measuring weather\n";
-    humidity.resize(noiseWidth * noiseHeight);
-    temperature.resize(noiseWidth * noiseHeight);
     std::uniform_int_distribution<int64_t> dist(
         0,
         std::numeric_limits<int64_t>::max());
-    OpenSimplexNoise noise{dist(rnd)};
-    parallelFor(
-        std::views::iota(0, noiseWidth),
-        [scale, &conf, &noise, this](int x) {
+    shared->biomeNoise = std::make_unique<NoiseCache<2>>(
+        shared->width,
+        shared->height,
+        [scale,
+         conf,
+         noiseWidth = shared->width,
+         noiseHeight = shared->height,
+         simplex = OpenSimplexNoise{dist(rnd)}](
+            int x,
+            int y,
+            auto &out) mutable {
             double offset = scale * (noiseWidth + noiseHeight);
             double xS = 1.4 * scale * x;
-            for (int y = 0; y < noiseHeight; ++y) {
-                double yS = scale * y;
-                int index = x * noiseHeight + y;
-                humidity[index] = noise.Evaluate(xS, yS) +
-                                  0.5 * noise.Evaluate(2 * xS, 2 * yS) +
-                                  0.25 * noise.Evaluate(4 * xS, 4 * yS) +
-                                  conf.patchesHumidity;
-                temperature[index] =
-                    noise.Evaluate(offset + xS, offset + yS) +
-                    0.5 * noise.Evaluate(offset + 2 * xS, offset + 2 * yS) +
-                    0.25 * noise.Evaluate(offset + 4 * xS, offset + 4 * yS) +
-                    std::max(0.01 * (y + 355 - noiseHeight), 0.0) +
-                    conf.patchesTemperature;
-                if (conf.hiveQueen || conf.biomes == BiomeLayout::layers) {
-                    double forestBoost = 0;
-                    double snowBoost = 0;
-                    double desertBoost = 0;
-                    double jungleBoost = 0;
-                    if (conf.biomes == BiomeLayout::layers) {
-                        forestBoost = std::clamp(
-                            0.9 - 2.1 * std::abs(y - 0.196 * noiseHeight) /
-                                      noiseHeight,
-                            0.0,
-                            0.53);
-                        snowBoost = std::clamp(
-                            conf.snowSize * 0.7 -
-                                4.8 * std::abs(y - 0.345 * noiseHeight) /
-                                    noiseHeight,
-                            0.0,
-                            0.5);
-                        desertBoost = std::clamp(
-                            conf.desertSize * 0.7 -
-                                4.8 * std::abs(y - 0.526 * noiseHeight) /
-                                    noiseHeight,
-                            0.0,
-                            0.5);
-                        jungleBoost = std::clamp(
-                            conf.jungleSize * 0.73 -
-                                4.5 * std::abs(y - 0.759 * noiseHeight) /
-                                    noiseHeight,
-                            0.0,
-                            0.5);
-                    }
-                    if (conf.hiveQueen) {
-                        jungleBoost = std::max(
-                            std::min(
-                                0.7 - 2.4 * std::abs(x - 0.5 * noiseWidth) /
-                                          noiseWidth,
-                                0.5),
-                            jungleBoost);
-                    }
-                    for (auto [boost, minH, maxH, minT, maxT] : {
-                             std::tuple{forestBoost, -0.15, 0.0, -0.15, 0.0},
-                             {snowBoost, -0.1, 0.1, -2.0, -1.1},
-                             {desertBoost, -2, -1.1, -0.1, 0.1},
-                             {jungleBoost, 0.82, 1.01, 0.82, 1.01},
-                         }) {
-                        humidity[index] = std::lerp(
-                            humidity[index],
-                            std::clamp(humidity[index], minH, maxH),
-                            boost);
-                        temperature[index] = std::lerp(
-                            temperature[index],
-                            std::clamp(temperature[index], minT, maxT),
-                            boost);
-                    }
+            double yS = scale * y;
+            out[0] = simplex.Evaluate(xS, yS) +
+                     0.5 * simplex.Evaluate(2 * xS, 2 * yS) +
+                     0.25 * simplex.Evaluate(4 * xS, 4 * yS) +
+                     conf.patchesHumidity;
+            out[1] =
+                simplex.Evaluate(offset + xS, offset + yS) +
+                0.5 * simplex.Evaluate(offset + 2 * xS, offset + 2 * yS) +
+                0.25 * simplex.Evaluate(offset + 4 * xS, offset + 4 * yS) +
+                std::max(0.01 * (y + 355 - noiseHeight), 0.0) +
+                conf.patchesTemperature;
+            if (conf.hiveQueen || conf.biomes == BiomeLayout::layers) {
+                double forestBoost = 0;
+                double snowBoost = 0;
+                double desertBoost = 0;
+                double jungleBoost = 0;
+                if (conf.biomes == BiomeLayout::layers) {
+                    forestBoost = std::clamp(
+                        0.9 - 2.1 * std::abs(y - 0.196 * noiseHeight) /
+                                  noiseHeight,
+                        0.0,
+                        0.53);
+                    snowBoost = std::clamp(
+                        conf.snowSize * 0.7 -
+                            4.8 * std::abs(y - 0.345 * noiseHeight) /
+                                noiseHeight,
+                        0.0,
+                        0.5);
+                    desertBoost = std::clamp(
+                        conf.desertSize * 0.7 -
+                            4.8 * std::abs(y - 0.526 * noiseHeight) /
+                                noiseHeight,
+                        0.0,
+                        0.5);
+                    jungleBoost = std::clamp(
+                        conf.jungleSize * 0.73 -
+                            4.5 * std::abs(y - 0.759 * noiseHeight) /
+                                noiseHeight,
+                        0.0,
+                        0.5);
+                }
+                if (conf.hiveQueen) {
+                    jungleBoost = std::max(
+                        std::min(
+                            0.7 - 2.4 * std::abs(x - 0.5 * noiseWidth) /
+                                      noiseWidth,
+                            0.5),
+                        jungleBoost);
+                }
+                for (auto [boost, minH, maxH, minT, maxT] : {
+                         std::tuple{forestBoost, -0.15, 0.0, -0.15, 0.0},
+                         {snowBoost, -0.1, 0.1, -2.0, -1.1},
+                         {desertBoost, -2, -1.1, -0.1, 0.1},
+                         {jungleBoost, 0.82, 1.01, 0.82, 1.01},
+                     }) {
+                    out[0] = std::lerp(
+                        out[0],
+                        std::clamp(out[0], minH, maxH),
+                        boost);
+                    out[1] = std::lerp(
+                        out[1],
+                        std::clamp(out[1], minT, maxT),
+                        boost);
                 }
             }
         });
 }
 
-int Random::getPoolIndex(int size, std::source_location origin)
+int Random::getPoolIndex(int size, uint64_t site)
 {
-    std::string key = std::to_string(origin.line()) + ':' +
-                      std::to_string(origin.column()) + ':' +
-                      origin.function_name();
-    if (!poolState.contains(key)) {
-        poolState[key] = getInt(0, size - 1);
+    if (2 * (numPoolSites + 1) > poolState.size()) {
+        // Keep load factor at most 1/2.
+        std::vector<std::pair<uint64_t, int>> prevState(
+            std::max<size_t>(16, 2 * poolState.size()));
+        prevState.swap(poolState);
+        size_t mask = poolState.size() - 1;
+        for (const auto &entry : prevState) {
+            if (entry.first != 0) {
+                size_t idx = entry.first & mask;
+                while (poolState[idx].first != 0) {
+                    idx = (idx + 1) & mask;
+                }
+                poolState[idx] = entry;
+            }
+        }
+    }
+    size_t mask = poolState.size() - 1;
+    size_t idx = site & mask;
+    while (poolState[idx].first != site) {
+        if (poolState[idx].first == 0) {
+            poolState[idx] = {site, getInt(0, size - 1)};
+            ++numPoolSites;
+            break;
+        }
+        idx = (idx + 1) & mask;
     }
-    ++poolState[key];
-    return poolState[key] % size;
+    return ++poolState[idx].second % size;
 }
 
 void Random::shuffleNoise()
 {
-    noiseDeltaX = getInt(0, noiseWidth);
-    noiseDeltaY = getInt(0, noiseHeight);
+    noiseDeltaX = getInt(0, shared->width);
+    noiseDeltaY = getInt(0, shared->height);
 }
 
 void Random::saveShuffleState()
 {
-    savedNoiseDeltaX = noiseDeltaX;
-    savedNoiseDeltaY = noiseDeltaY;
+    shared->savedDeltaX = noiseDeltaX;
+    shared->savedDeltaY = noiseDeltaY;
 }
 
 void Random::restoreShuffleState()
 {
-    noiseDeltaX = savedNoiseDeltaX;
-    noiseDeltaY = savedNoiseDeltaY;
+    noiseDeltaX = shared->savedDeltaX;
+    noiseDeltaY = shared->savedDeltaY;
 }
 
 bool Random::getBool()
@@ -235,6 +330,20 @@ int Random::getInt(int min, int max)
     return dist(rnd);
 }
 
+double Random::getShuffledNoise(int x, int y, size_t channel) const
+{
+    // Note: positive out-of-bounds is fine, negative may crash.
+    x = (x + noiseDeltaX) % shared->width;
+    y = (y + noiseDeltaY) % shared->height;
+    if (y < 0) {
+        // Match column-major flat array indexing, where a negative row reads
+        // from the end of the previous column.
+        y += shared->height;
+        --x;
+    }
+    return shared->noise->get(x, y, channel);
+}
+
 uint32_t Random::getStableUint(int x, int y) const
 {
     return lowbias32(static_cast<int>(999999999 * getFineNoise(x, y)));
@@ -243,39 +352,36 @@ uint32_t Random::getStableUint(int x, int y) const
 double Random::getBlurNoise(int x, int y) const
 {
     // Note: positive out-of-bounds is fine, negative may crash.
-    return blurNoise
-        [noiseHeight * ((x + noiseDeltaX) % noiseWidth) +
-         ((y + noiseDeltaY) % noiseHeight)];
+    std::call_once(shared->blurNoise->computed, [this] {
+        computeBlurNoise();
+    });
+    return shared->blurNoise->data
+        [shared->height * ((x + noiseDeltaX) % shared->width) +
+         ((y + noiseDeltaY) % shared->height)];
 }
 
 double Random::getCoarseNoise(int x, int y) const
 {
-    // Note: positive out-of-bounds is fine, negative may crash.
-    return coarseNoise
-        [noiseHeight * ((x + noiseDeltaX) % noiseWidth) +
-         ((y + noiseDeltaY) % noiseHeight)];
+    return getShuffledNoise(x, y, 1);
 }
 
 double Random::getFineNoise(int x, int y) const
 {
-    // Note: positive out-of-bounds is fine, negative may crash.
-    return fineNoise
-        [noiseHeight * ((x + noiseDeltaX) % noiseWidth) +
-         ((y + noiseDeltaY) % noiseHeight)];
+    return getShuffledNoise(x, y, 0);
 }
 
 double Random::getHumidity(int x, int y) const
 {
-    return x < 0 || y < 0 || x >= noiseWidth || y >= noiseHeight
+    return x < 0 || y < 0 || x >= shared->width || y >= shared->height
                ? 0
-               : humidity[noiseHeight * x + y];
+               : shared->biomeNoise->get(x, y, 0);
 }
 
 double Random::getTemperature(int x, int y) const
 {
-    return x < 0 || y < 0 || x >= noiseWidth || y >= noiseHeight
+    return x < 0 || y < 0 || x >= shared->width || y >= shared->height
                ? 0
-               : temperature[noiseHeight * x + y];
+               : shared->biomeNoise->get(x, y, 1);
 }
 
 std::vector<int> Random::partitionRange(int numSegments, int range)
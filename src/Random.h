@@ -1,9 +1,14 @@
 #ifndef RANDOM_H
 #define RANDOM_H
 
-#include <map>
+#include "NoiseCache.h"
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <random>
 #include <source_location>
+#include <string>
+#include <string_view>
 #include <vector>
 
 struct Config;
@@ -11,36 +16,89 @@ struct Config;
 class Random
 {
 private:
-    std::vector<double> blurNoise;
-    std::vector<double> coarseNoise;
-    std::vector<double> fineNoise;
-    std::vector<double> humidity;
-    std::vector<double> temperature;
-    int noiseWidth;
-    int noiseHeight;
+    struct BlurNoise {
+        std::once_flag computed;
+        std::vector<double> data;
+    };
+
+    /**
+     * Noise samples, shared by a stream and all streams forked from it.
+     */
+    struct SharedNoise {
+        // Channels: fine, coarse.
+        std::unique_ptr<NoiseCache<2>> noise;
+        // Channels: humidity, temperature.
+        std::unique_ptr<NoiseCache<2>> biomeNoise;
+        std::unique_ptr<BlurNoise> blurNoise;
+        int width = 0;
+        int height = 0;
+        int savedDeltaX = 0;
+        int savedDeltaY = 0;
+    };
+
+    /**
+     * Call site of a pool() selection, hashed from its line, column, and
+     * function name. The constructor is consteval, so the hash is always
+     * computed at compile time and each call site passes a constant key.
+     */
+    struct PoolSite {
+        uint64_t key;
+
+        consteval PoolSite(
+            std::source_location origin = std::source_location::current())
+            : key(14695981039346656037u)
+        {
+            for (const char *c = origin.function_name(); *c != '\0'; ++c) {
+                key = (key ^ static_cast<unsigned char>(*c)) * 1099511628211u;
+            }
+            key = (key ^ origin.line()) * 1099511628211u;
+            key = (key ^ origin.column()) * 1099511628211u;
+            // Zero marks an empty slot in poolState.
+            key |= 1;
+        }
+    };
+
+    std::shared_ptr<SharedNoise> shared;
+    uint64_t seedHash;
     int noiseDeltaX;
     int noiseDeltaY;
-    int savedNoiseDeltaX;
-    int savedNoiseDeltaY;
-    std::map<std::string, int> poolState;
+    /**
+     * Open addressed (site key, counter) table for pool(), sized to a power of
+     * two.
+     */
+    std::vector<std::pair<uint64_t, int>> poolState;
+    size_t numPoolSites;
     std::mt19937_64 rnd;
 
-    void computeBlurNoise();
+    void computeBlurNoise() const;
+    double getShuffledNoise(int x, int y, size_t channel) const;
 
-    int getPoolIndex(int size, std::source_location origin);
+    int getPoolIndex(int size, uint64_t site);
 
 public:
     Random();
 
     void setSeed(const std::string &seed);
 
+    /**
+     * Create an independent stream, seeded from this stream's seed and the
+     * key. Forks with the same seed and key produce the same values,
+     * regardless of how much any other stream has been used.
+     *
+     * The fork shares noise samples with this stream, but starts from its own
+     * randomly shuffled noise offsets. Offsets are drawn over the noise size
+     * set by initNoise(), so forks must not be created concurrently with it.
+     */
+    Random fork(std::string_view key) const;
+
     std::mt19937_64 &getPRNG()
     {
         return rnd;
     }
 
     /**
-     * Precompute noise samples for other noise functions.
+     * Prepare noise samples for other noise functions. Samples are computed
+     * on first access.
      */
     void initNoise(int width, int height, double scale);
     void initBiomeNoise(double scale, const Config &conf);
@@ -50,7 +108,8 @@ public:
      */
     void shuffleNoise();
     /**
-     * Save current noise offsets.
+     * Save current noise offsets. Saved offsets are shared with forked
+     * streams, so later steps can match noise used by an earlier step.
      */
     void saveShuffleState();
     /**
@@ -106,17 +165,13 @@ public:
      * loop/wrapper function.
      */
     template <typename T>
-    T pool(
-        std::initializer_list<T> list,
-        std::source_location origin = std::source_location::current())
+    T pool(std::initializer_list<T> list, PoolSite site = {})
     {
-        return *(list.begin() + getPoolIndex(list.size(), origin));
+        return *(list.begin() + getPoolIndex(list.size(), site.key));
     }
-    template <typename T>
-    auto
-    pool(T list, std::source_location origin = std::source_location::current())
+    template <typename T> auto pool(T list, PoolSite site = {})
     {
-        return *(list.begin() + getPoolIndex(list.size(), origin));
+        return *(list.begin() + getPoolIndex(list.size(), site.key));
     }
 
     /**
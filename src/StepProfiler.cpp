@@ -0,0 +1,184 @@
+#include "StepProfiler.h"
+
+#include "Util.h"
+#include "World.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace
+{
+
+/**
+ * Process CPU time across all threads, in seconds.
+ */
+double getCpuTime()
+{
+#ifdef _WIN32
+    FILETIME creation, exit, kernel, user;
+    GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user);
+    auto toSeconds = [](FILETIME t) {
+        return 1e-7 * ((static_cast<uint64_t>(t.dwHighDateTime) << 32) |
+                       t.dwLowDateTime);
+    };
+    return toSeconds(kernel) + toSeconds(user);
+#else
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec +
+           1e-6 * (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+#endif
+}
+
+/**
+ * Peak resident memory of the process, in KiB.
+ */
+long getPeakRss()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+    return counters.PeakWorkingSetSize / 1024;
+#else
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+#endif
+}
+
+} // namespace
+
+StepProfiler::StepProfiler(World &w)
+    : world(w), origin(std::chrono::steady_clock::now()),
+      stepStart(origin), stepCpuStart(0), stepRssStart(0)
+{
+    snapshot.resize(world.getWidth() * world.getHeight());
+    updateSnapshot();
+}
+
+size_t StepProfiler::updateSnapshot()
+{
+    std::atomic<size_t> changed = 0;
+    parallelFor(
+        std::views::iota(0, world.getWidth()),
+        [&changed, this](int x) {
+            size_t columnChanged = 0;
+            Tile *column = snapshot.data() + x * world.getHeight();
+            for (int y = 0; y < world.getHeight(); ++y) {
+                Tile &tile = world.getTile(x, y);
+                if (!(column[y] == tile)) {
+                    column[y] = tile;
+                    ++columnChanged;
+                }
+            }
+            changed += columnChanged;
+        });
+    return changed;
+}
+
+void StepProfiler::beginStep()
+{
+    stepRssStart = getPeakRss();
+    stepCpuStart = getCpuTime();
+    stepStart = std::chrono::steady_clock::now();
+}
+
+void StepProfiler::endStep(const std::string &name)
+{
+    auto stepEnd = std::chrono::steady_clock::now();
+    double cpuEnd = getCpuTime();
+    long rssEnd = getPeakRss();
+    stats.push_back(
+        {name,
+         std::chrono::duration<double>(stepStart - origin).count(),
+         std::chrono::duration<double>(stepEnd - stepStart).count(),
+         cpuEnd - stepCpuStart,
+         rssEnd - stepRssStart,
+         updateSnapshot()});
+}
+
+void StepProfiler::printTable() const
+{
+    double totalWall = 0;
+    double totalCpu = 0;
+    size_t nameWidth = 5;
+    for (const auto &step : stats) {
+        totalWall += step.wallTime;
+        totalCpu += step.cpuTime;
+        nameWidth = std::max(nameWidth, step.name.size());
+    }
+    auto flags = std::cout.flags();
+    auto precision = std::cout.precision();
+    std::cout << '\n'
+              << std::left << std::setw(nameWidth) << "Step" << std::right
+              << std::setw(10) << "Wall ms" << std::setw(10) << "CPU ms"
+              << std::setw(8) << "Wall %" << std::setw(12) << "Peak +MiB"
+              << std::setw(14) << "Tiles changed" << '\n'
+              << std::fixed;
+    for (const auto &step : stats) {
+        std::cout << std::left << std::setw(nameWidth) << step.name
+                  << std::right << std::setprecision(1) << std::setw(10)
+                  << 1000 * step.wallTime << std::setw(10)
+                  << 1000 * step.cpuTime << std::setw(8)
+                  << 100 * step.wallTime / totalWall << std::setw(12)
+                  << step.peakRssDelta / 1024.0 << std::setw(14)
+                  << step.tilesChanged << '\n';
+    }
+    std::cout << std::left << std::setw(nameWidth) << "Total" << std::right
+              << std::setw(10) << 1000 * totalWall << std::setw(10)
+              << 1000 * totalCpu << '\n';
+    std::cout.flags(flags);
+    std::cout.precision(precision);
+}
+
+bool StepProfiler::saveJson(const std::string &filename) const
+{
+    std::ofstream out(filename);
+    // Step names are plain identifiers, so need no escaping.
+    out << "[\n";
+    for (size_t i = 0; i < stats.size(); ++i) {
+        const auto &step = stats[i];
+        out << "  {\"name\": \"" << step.name << "\", \"start\": "
+            << step.start << ", \"wallTime\": " << step.wallTime
+            << ", \"cpuTime\": " << step.cpuTime
+            << ", \"peakRssDeltaKiB\": " << step.peakRssDelta
+            << ", \"tilesChanged\": " << step.tilesChanged << '}'
+            << (i + 1 < stats.size() ? ",\n" : "\n");
+    }
+    out << "]\n";
+    return static_cast<bool>(out);
+}
+
+bool StepProfiler::saveTrace(const std::string &filename) const
+{
+    std::ofstream out(filename);
+    out << "{\"traceEvents\": [\n";
+    for (size_t i = 0; i < stats.size(); ++i) {
+        const auto &step = stats[i];
+        out << "  {\"name\": \"" << step.name
+            << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": 1, \"ts\": "
+            << std::llround(1e6 * step.start)
+            << ", \"dur\": " << std::llround(1e6 * step.wallTime)
+            << ", \"args\": {\"cpuMs\": " << 1000 * step.cpuTime
+            << ", \"peakRssDeltaKiB\": " << step.peakRssDelta
+            << ", \"tilesChanged\": " << step.tilesChanged << "}}"
+            << (i + 1 < stats.size() ? ",\n" : "\n");
+    }
+    out << "], \"displayTimeUnit\": \"ms\"}\n";
+    return static_cast<bool>(out);
+}
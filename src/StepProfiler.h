@@ -0,0 +1,62 @@
+#ifndef STEPPROFILER_H
+#define STEPPROFILER_H
+
+#include "Tile.h"
+#include <chrono>
+#include <string>
+#include <vector>
+
+class World;
+
+struct StepStats {
+    std::string name;
+    double start;      // Seconds since profiling began.
+    double wallTime;   // Seconds.
+    double cpuTime;    // Seconds, summed across all threads.
+    long peakRssDelta; // KiB.
+    size_t tilesChanged;
+};
+
+/**
+ * Records resource usage of each generation step.
+ *
+ * Counting changed tiles keeps a full copy of the world's tiles, so
+ * profiling roughly doubles tile memory.
+ */
+class StepProfiler
+{
+private:
+    World &world;
+    std::vector<Tile> snapshot;
+    std::vector<StepStats> stats;
+    std::chrono::steady_clock::time_point origin;
+    std::chrono::steady_clock::time_point stepStart;
+    double stepCpuStart;
+    long stepRssStart;
+
+    size_t updateSnapshot();
+
+public:
+    StepProfiler(World &w);
+
+    void beginStep();
+    void endStep(const std::string &name);
+
+    const std::vector<StepStats> &getStats() const
+    {
+        return stats;
+    }
+
+    void printTable() const;
+    /**
+     * Save stats as a JSON array of step records.
+     */
+    bool saveJson(const std::string &filename) const;
+    /**
+     * Save stats in Chrome trace event format, viewable in chrome://tracing
+     * or Perfetto.
+     */
+    bool saveTrace(const std::string &filename) const;
+};
+
+#endif // STEPPROFILER_H
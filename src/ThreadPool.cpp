@@ -0,0 +1,177 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+namespace
+{
+// Set on pool workers, and on the submitting thread while it helps run a job.
+thread_local bool insideJob = false;
+} // namespace
+
+ThreadPool::ThreadPool()
+    : body(nullptr), generation(0), busyWorkers(0), numThreads(0),
+      stopping(false)
+{
+    setNumThreads(0);
+}
+
+ThreadPool::~ThreadPool()
+{
+    stop();
+}
+
+ThreadPool &ThreadPool::get()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+void ThreadPool::setNumThreads(int count)
+{
+    if (count <= 0) {
+        count = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    std::lock_guard lock(submitMut);
+    if (count == numThreads) {
+        return;
+    }
+    stop();
+    numThreads = count;
+    start();
+}
+
+void ThreadPool::start()
+{
+    shares = std::vector<Share>(numThreads);
+    stopping = false;
+    for (int id = 1; id < numThreads; ++id) {
+        workers.emplace_back(&ThreadPool::workerLoop, this, id, generation);
+    }
+}
+
+void ThreadPool::stop()
+{
+    {
+        std::lock_guard lock(stateMut);
+        stopping = true;
+    }
+    jobReady.notify_all();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+}
+
+void ThreadPool::workerLoop(size_t id, size_t seenGeneration)
+{
+    insideJob = true;
+    std::unique_lock lock(stateMut);
+    while (true) {
+        jobReady.wait(lock, [this, seenGeneration] {
+            return stopping || generation != seenGeneration;
+        });
+        if (stopping) {
+            return;
+        }
+        seenGeneration = generation;
+        lock.unlock();
+        runShares(id);
+        lock.lock();
+        if (--busyWorkers == 0) {
+            jobDone.notify_one();
+        }
+    }
+}
+
+void ThreadPool::runShares(size_t id)
+{
+    size_t begin;
+    size_t end;
+    do {
+        while (takeChunk(id, begin, end)) {
+            (*body)(begin, end);
+        }
+    } while (stealChunk(id));
+}
+
+bool ThreadPool::takeChunk(size_t id, size_t &begin, size_t &end)
+{
+    Share &share = shares[id];
+    std::lock_guard lock(share.mut);
+    if (share.begin == share.end) {
+        return false;
+    }
+    // Claim progressively smaller chunks, leaving a stealable tail.
+    size_t chunkSize = std::max<size_t>((share.end - share.begin) / 8, 1);
+    begin = share.begin;
+    end = begin + chunkSize;
+    share.begin = end;
+    return true;
+}
+
+bool ThreadPool::stealChunk(size_t id)
+{
+    while (true) {
+        size_t victim = id;
+        size_t mostRemaining = 0;
+        for (size_t i = 1; i < shares.size(); ++i) {
+            size_t candidate = (id + i) % shares.size();
+            std::lock_guard lock(shares[candidate].mut);
+            size_t remaining =
+                shares[candidate].end - shares[candidate].begin;
+            if (remaining > mostRemaining) {
+                victim = candidate;
+                mostRemaining = remaining;
+            }
+        }
+        if (victim == id) {
+            return false;
+        }
+        std::scoped_lock lock(shares[id].mut, shares[victim].mut);
+        Share &from = shares[victim];
+        if (from.begin == from.end) {
+            // Drained while scanning; look again.
+            continue;
+        }
+        size_t mid = from.begin + (from.end - from.begin) / 2;
+        shares[id].begin = mid;
+        shares[id].end = from.end;
+        from.end = mid;
+        return true;
+    }
+}
+
+void ThreadPool::run(
+    size_t total,
+    const std::function<void(size_t, size_t)> &jobBody)
+{
+    if (total == 0) {
+        return;
+    }
+    if (total < 2 || insideJob || !submitMut.try_lock()) {
+        jobBody(0, total);
+        return;
+    }
+    std::lock_guard submitLock(submitMut, std::adopt_lock);
+    if (workers.empty()) {
+        jobBody(0, total);
+        return;
+    }
+    for (size_t i = 0; i < shares.size(); ++i) {
+        shares[i].begin = total * i / shares.size();
+        shares[i].end = total * (i + 1) / shares.size();
+    }
+    {
+        std::lock_guard lock(stateMut);
+        body = &jobBody;
+        busyWorkers = workers.size();
+        ++generation;
+    }
+    jobReady.notify_all();
+    insideJob = true;
+    runShares(0);
+    insideJob = false;
+    std::unique_lock lock(stateMut);
+    jobDone.wait(lock, [this] { return busyWorkers == 0; });
+    body = nullptr;
+}
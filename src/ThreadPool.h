@@ -0,0 +1,76 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Process-wide pool of persistent worker threads, shared by all parallel
+ * loops.
+ *
+ * Each job is an index range, split evenly across workers. Workers consume
+ * their own share front to back in shrinking chunks, then steal the back half
+ * of the largest remaining share, so uneven per-index costs still balance.
+ */
+class ThreadPool
+{
+private:
+    struct Share {
+        std::mutex mut;
+        size_t begin;
+        size_t end;
+    };
+
+    std::vector<std::thread> workers;
+    std::vector<Share> shares;
+    std::mutex submitMut;
+    std::mutex stateMut;
+    std::condition_variable jobReady;
+    std::condition_variable jobDone;
+    const std::function<void(size_t, size_t)> *body;
+    size_t generation;
+    size_t busyWorkers;
+    int numThreads;
+    bool stopping;
+
+    ThreadPool();
+    ~ThreadPool();
+
+    void start();
+    void stop();
+    void workerLoop(size_t id, size_t seenGeneration);
+    void runShares(size_t id);
+    bool takeChunk(size_t id, size_t &begin, size_t &end);
+    bool stealChunk(size_t id);
+
+public:
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    static ThreadPool &get();
+
+    /**
+     * Number of threads (including the calling thread) to run jobs on. Use 0
+     * to match available hardware concurrency.
+     */
+    void setNumThreads(int count);
+    int getNumThreads() const
+    {
+        return numThreads;
+    }
+
+    /**
+     * Call body on disjoint subranges covering [0, total), and block until all
+     * complete.
+     *
+     * Jobs submitted from inside a running job (or while another thread's job
+     * is active) run inline on the calling thread, avoiding oversubscription.
+     */
+    void
+    run(size_t total, const std::function<void(size_t, size_t)> &jobBody);
+};
+
+#endif // THREADPOOL_H
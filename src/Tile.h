@@ -2,14 +2,22 @@
 #define TILE_H
 
 #include "ids/TileID.h"
+#include <cstdint>
 
-enum class Liquid { none, water, lava, honey, shimmer };
+enum class Liquid : uint8_t { none, water, lava, honey, shimmer };
 
 // Described location is the portion of the block that will display as empty
 // space.
-enum class Slope { none = 0, half, topRight, topLeft, bottomRight, bottomLeft };
+enum class Slope : uint8_t {
+    none = 0,
+    half,
+    topRight,
+    topLeft,
+    bottomRight,
+    bottomLeft
+};
 
-enum class Flag {
+enum class Flag : uint8_t {
     none,
     border,
     hive,
@@ -20,15 +28,22 @@ enum class Flag {
     anchor,
 };
 
+/**
+ * Packed to 16 bytes; worlds store one per location. Field widths cover the
+ * full range of vanilla IDs, frames, and paints.
+ *
+ * Tiles are stored whole rather than as per-field planes, since generators
+ * hold Tile references and read and write several fields of each.
+ */
 class Tile
 {
 public:
-    int blockID = TileID::empty;
-    int frameX;
-    int frameY;
-    int wallID;
-    int blockPaint;
-    int wallPaint;
+    int16_t blockID = TileID::empty;
+    int16_t frameX;
+    int16_t frameY;
+    int16_t wallID;
+    uint8_t blockPaint;
+    uint8_t wallPaint;
     Liquid liquid;
     Slope slope;
     bool wireRed : 1;
@@ -56,4 +71,6 @@ public:
     }
 };
 
+static_assert(sizeof(Tile) == 16);
+
 #endif // TILE_H
@@ -1,9 +1,13 @@
 #include "TileBuffer.h"
 
+#include "ids/TileID.h"
+
 TileBuffer::TileBuffer(const uint16_t *data, const FramedBitset &framedTiles)
-    : width(*data >> 8), height(*data & 0xff), tiles(width * height)
+    : width(*data >> 8), height(*data & 0xff),
+      tiles(std::make_shared<std::vector<Tile>>(width * height))
 {
     ++data;
+    std::vector<Tile> &tiles = *this->tiles;
     int rle = 0;
     for (size_t i = 0; i < tiles.size(); ++i) {
         if (rle > 0) {
@@ -67,19 +71,60 @@ TileBuffer::TileBuffer(const uint16_t *data, const FramedBitset &framedTiles)
     }
 }
 
-Tile &TileBuffer::getTile(int x, int y)
+void TileBuffer::makeUnique()
 {
-    return tiles[y + x * height];
+    tiles = std::make_shared<std::vector<Tile>>(*tiles);
 }
 
-const Tile &TileBuffer::getTile(int x, int y) const
+const std::vector<Point> &TileBuffer::getStorageLocations() const
 {
-    return tiles[y + x * height];
+    if (!storageLocations) {
+        auto locations = std::make_shared<std::vector<Point>>();
+        for (int i = 0; i < width; ++i) {
+            for (int j = 0; j < height; ++j) {
+                const Tile &tile = getTile(i, j);
+                if (((tile.blockID == TileID::dresser &&
+                      tile.frameX % 54 == 0) ||
+                     ((tile.blockID == TileID::chest ||
+                       tile.blockID == TileID::chestGroup2) &&
+                      tile.frameX % 36 == 0)) &&
+                    tile.frameY == 0) {
+                    locations->emplace_back(i, j);
+                }
+            }
+        }
+        storageLocations = locations;
+    }
+    return *storageLocations;
 }
 
 void TileBuffer::resize(int w, int h)
 {
     width = w;
     height = h;
-    tiles.resize(w * h);
+    storageLocations.reset();
+    if (!tiles) {
+        tiles = std::make_shared<std::vector<Tile>>(w * h);
+        return;
+    }
+    if (tiles.use_count() > 1) {
+        makeUnique();
+    }
+    tiles->resize(w * h);
+}
+
+TileBufferCache::TileBufferCache(
+    std::span<const std::span<const uint16_t>> data)
+    : data(data), decoded(data.size()), buffers(data.size())
+{
+}
+
+TileBuffer TileBufferCache::get(int id, const FramedBitset &framedTiles)
+{
+    std::call_once(decoded[id], [this, id, &framedTiles]() {
+        buffers[id] = {data[id].data(), framedTiles};
+        // Fill before sharing, so copies never race to compute it.
+        buffers[id].getStorageLocations();
+    });
+    return buffers[id];
 }
@@ -1,17 +1,27 @@
 #ifndef TILEBUFFER_H
 #define TILEBUFFER_H
 
+#include "Point.h"
 #include "Tile.h"
 #include "ids/FramedTiles.h"
 #include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
 #include <vector>
 
+/**
+ * Tiles are shared between copies, and copied on first mutable access.
+ */
 class TileBuffer
 {
 private:
     int width;
     int height;
-    std::vector<Tile> tiles;
+    std::shared_ptr<std::vector<Tile>> tiles;
+    mutable std::shared_ptr<const std::vector<Point>> storageLocations;
+
+    void makeUnique();
 
 public:
     TileBuffer() = default;
@@ -20,9 +30,27 @@ public:
      */
     TileBuffer(const uint16_t *data, const FramedBitset &framedTiles);
 
-    Tile &getTile(int x, int y);
+    Tile &getTile(int x, int y)
+    {
+        if (tiles.use_count() > 1) {
+            makeUnique();
+        }
+        if (storageLocations) {
+            storageLocations.reset();
+        }
+        return (*tiles)[y + x * height];
+    }
+
+    const Tile &getTile(int x, int y) const
+    {
+        return (*tiles)[y + x * height];
+    }
 
-    const Tile &getTile(int x, int y) const;
+    /**
+     * Offsets of chest and dresser origins. Computed on first request, then
+     * shared between copies until tiles are modified.
+     */
+    const std::vector<Point> &getStorageLocations() const;
 
     /**
      * Existing tiles are invalidated if height changes.
@@ -40,4 +68,24 @@ public:
     }
 };
 
+/**
+ * Structure templates, each decoded on first request. Returned buffers share
+ * the decoded tiles.
+ *
+ * Decoding uses the framedTiles from the first request for each template.
+ * Every caller passes the world's lookup, so these never differ.
+ */
+class TileBufferCache
+{
+private:
+    std::span<const std::span<const uint16_t>> data;
+    std::vector<std::once_flag> decoded;
+    std::vector<TileBuffer> buffers;
+
+public:
+    TileBufferCache(std::span<const std::span<const uint16_t>> data);
+
+    TileBuffer get(int id, const FramedBitset &framedTiles);
+};
+
 #endif // TILEBUFFER_H
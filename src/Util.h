@@ -1,12 +1,17 @@
 #ifndef UTIL_H
 #define UTIL_H
 
+#include "ThreadPool.h"
 #include <ranges>
-#include <thread>
-#include <vector>
 
 /**
- * Automatic thread management for parallel loop execution.
+ * Automatic thread management for parallel loop execution. Iterations are
+ * distributed over the shared ThreadPool; nested calls run serially on the
+ * calling thread.
+ *
+ * Iterations run in no fixed order, so f must not read or write anything
+ * another iteration writes (such as neighboring columns of tiles). Loops that
+ * do must stay plain loops, so worlds do not depend on the thread count.
  *
  * Before:
  * @code
@@ -23,24 +28,16 @@
  * @endcode
  */
 template <std::ranges::input_range R, class UnaryFunc>
-constexpr void parallelFor(R &&r, UnaryFunc f)
+void parallelFor(R &&r, UnaryFunc f)
 {
-    std::vector<std::thread> pool;
-    size_t numThreads = std::max(std::thread::hardware_concurrency(), 4u);
-    size_t total = std::distance(r.begin(), r.end());
-    size_t chunkSize = std::max<size_t>(total / numThreads, 1);
-    for (size_t chunkStart = 0; chunkStart < total; chunkStart += chunkSize) {
-        pool.emplace_back([&r, &f, chunkStart, chunkSize]() {
-            auto itr = r.begin();
-            std::advance(itr, chunkStart);
-            for (size_t i = 0; i < chunkSize && itr != r.end(); ++i, ++itr) {
-                f(*itr);
-            }
-        });
-    }
-    for (auto &worker : pool) {
-        worker.join();
-    }
+    size_t total = std::ranges::distance(r);
+    ThreadPool::get().run(total, [&r, &f](size_t begin, size_t end) {
+        auto itr = std::ranges::begin(r);
+        std::advance(itr, begin);
+        for (size_t i = begin; i < end; ++i, ++itr) {
+            f(*itr);
+        }
+    });
 }
 
 #endif // UTIL_H
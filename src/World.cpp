@@ -7,6 +7,7 @@
 #include "ids/WallID.h"
 #include "vendor/HashProspector.h"
 #include "vendor/frozen/map.h"
+#include <algorithm>
 #include <iostream>
 
 constexpr FramedBitset genFramedTileLookup()
@@ -56,9 +57,9 @@ uint32_t hash32pt(uint32_t x, uint32_t y)
 }
 
 World::World(const Config &c)
-    : width(c.width), height(c.height), tiles(width * height),
+    : width(c.width), height(c.height), scratchTile(), tiles(width * height),
       framedTiles(genFramedTileLookup()), surface(width),
-      biomeMap(width * height), conf(c)
+      biomeMap(width * height), biomeSums(biomeMap, width, height), conf(c)
 {
 }
 
@@ -109,54 +110,68 @@ BiomeData &World::getBiome(int x, int y)
     return biomeMap[y + x * height];
 }
 
-std::vector<Point>
-World::placeBuffer(int x, int y, const TileBuffer &data, Blend blendMode)
+template <Blend blendMode>
+void World::placeBufferTiles(int x, int y, const TileBuffer &data)
 {
-    std::vector<Point> storageLocations;
-    for (int i = 0; i < data.getWidth(); ++i) {
-        for (int j = 0; j < data.getHeight(); ++j) {
-            const Tile &dataTile = data.getTile(i, j);
+    // Clip to the world once, then walk whole columns.
+    int minI = std::max(0, -x);
+    int maxI = std::min(data.getWidth(), width - x);
+    int minJ = std::max(0, -y);
+    int maxJ = std::min(data.getHeight(), height - y);
+    if (minJ >= maxJ) {
+        return;
+    }
+    for (int i = minI; i < maxI; ++i) {
+        const Tile *dataTile = &data.getTile(i, minJ);
+        Tile *tile = &tiles[y + minJ + (x + i) * height];
+        for (int j = minJ; j < maxJ; ++j, ++dataTile, ++tile) {
             if (blendMode == Blend::blockOnly &&
-                dataTile.blockID == TileID::empty) {
+                dataTile->blockID == TileID::empty) {
                 continue;
             }
-            Tile &tile = getTile(x + i, y + j);
-            if (dataTile.blockID == TileID::cloud) {
-                if (dataTile.slope != Slope::none &&
-                    tile.blockID != TileID::empty) {
-                    tile.slope = dataTile.slope;
-                    tile.guarded = true;
+            if (dataTile->blockID == TileID::cloud) {
+                if (dataTile->slope != Slope::none &&
+                    tile->blockID != TileID::empty) {
+                    tile->slope = dataTile->slope;
+                    tile->guarded = true;
                 }
                 continue;
             }
-            if (blendMode == Blend::blockOnly) {
-                tile.blockID = dataTile.blockID;
-                tile.frameX = dataTile.frameX;
-                tile.frameY = dataTile.frameY;
-                tile.blockPaint = dataTile.blockPaint;
-                tile.slope = dataTile.slope;
+            if constexpr (blendMode == Blend::blockOnly) {
+                tile->blockID = dataTile->blockID;
+                tile->frameX = dataTile->frameX;
+                tile->frameY = dataTile->frameY;
+                tile->blockPaint = dataTile->blockPaint;
+                tile->slope = dataTile->slope;
             } else {
-                int wallId = tile.wallID;
-                int wallPaint = tile.wallPaint;
-                tile = dataTile;
-                if (dataTile.wallID == WallID::Safe::cloud) {
-                    tile.wallID = WallID::empty;
-                } else if (dataTile.wallID == WallID::empty) {
-                    tile.wallID = wallId;
-                    tile.wallPaint = wallPaint;
+                int wallId = tile->wallID;
+                int wallPaint = tile->wallPaint;
+                *tile = *dataTile;
+                if (dataTile->wallID == WallID::Safe::cloud) {
+                    tile->wallID = WallID::empty;
+                } else if (dataTile->wallID == WallID::empty) {
+                    tile->wallID = wallId;
+                    tile->wallPaint = wallPaint;
                 }
             }
-            tile.guarded =
-                tile.blockID != TileID::empty || tile.wallID != WallID::empty;
-            if (((tile.blockID == TileID::dresser && tile.frameX % 54 == 0) ||
-                 ((tile.blockID == TileID::chest ||
-                   tile.blockID == TileID::chestGroup2) &&
-                  tile.frameX % 36 == 0)) &&
-                tile.frameY == 0) {
-                storageLocations.emplace_back(x + i, y + j);
-            }
+            tile->guarded =
+                tile->blockID != TileID::empty || tile->wallID != WallID::empty;
         }
     }
+}
+
+std::vector<Point>
+World::placeBuffer(int x, int y, const TileBuffer &data, Blend blendMode)
+{
+    if (blendMode == Blend::blockOnly) {
+        placeBufferTiles<Blend::blockOnly>(x, y, data);
+    } else {
+        placeBufferTiles<Blend::normal>(x, y, data);
+    }
+    std::vector<Point> storageLocations;
+    for (Point pt : data.getStorageLocations()) {
+        storageLocations.push_back(pt + Point{x, y});
+    }
     return storageLocations;
 }
 
@@ -1,6 +1,7 @@
 #ifndef WORLD_H
 #define WORLD_H
 
+#include "BiomeSums.h"
 #include "Chest.h"
 #include "Point.h"
 #include "QueuedTasks.h"
@@ -8,7 +9,9 @@
 #include "ids/Biome.h"
 #include "ids/FramedTiles.h"
 #include "ids/TileVariant.h"
+#include <cassert>
 #include <cstdint>
+#include <span>
 #include <vector>
 
 struct Config;
@@ -22,15 +25,20 @@ enum class Blend { normal, blockOnly };
  */
 uint32_t hash32pt(uint32_t x, uint32_t y);
 
+/**
+ * Worlds store one per location, so weights are single precision.
+ */
 struct BiomeData {
     Biome active;
-    double forest;
-    double snow;
-    double desert;
-    double jungle;
-    double underworld;
+    float forest;
+    float snow;
+    float desert;
+    float jungle;
+    float underworld;
 };
 
+static_assert(sizeof(BiomeData) == 24);
+
 class World
 {
 private:
@@ -42,6 +50,10 @@ private:
     FramedBitset framedTiles;
     std::vector<int> surface;
     std::vector<BiomeData> biomeMap;
+    BiomeSums biomeSums;
+
+    template <Blend blendMode>
+    void placeBufferTiles(int x, int y, const TileBuffer &data);
 
 public:
     World(const Config &c);
@@ -57,7 +69,36 @@ public:
     {
         return getTile(pt.x, pt.y);
     }
+    /**
+     * Unchecked view of all tiles in a column, for hot loops that already
+     * stay in bounds. Debug builds (`make DEBUG=1`) check both the column
+     * and indexing into it.
+     */
+    std::span<Tile> column(int x)
+    {
+#ifdef DEBUG_BOUNDS
+        assert(x >= 0 && x < width);
+#endif
+        return {
+            tiles.data() + static_cast<size_t>(x) * height,
+            static_cast<size_t>(height)};
+    }
     BiomeData &getBiome(int x, int y);
+    /**
+     * Sum of a biome's weight over the area. Weights outside the world
+     * follow getBiome().
+     */
+    double getBiomeSum(Biome biome, int x, int y, int w, int h)
+    {
+        return biomeSums.sum(biome, x, y, w, h);
+    }
+    /**
+     * Must be called after changing biome weights in an area.
+     */
+    void invalidateBiomeSums(int x, int y, int w, int h)
+    {
+        biomeSums.invalidate(x, y, w, h);
+    }
     std::vector<Point> placeBuffer(
         int x,
         int y,
@@ -87,6 +128,10 @@ public:
     /**
      * Check if all tiles in the area pass a predicate.
      *
+     * Reads tiles directly rather than from summed-area tables: areas average
+     * under two tiles, and tiles are written through references everywhere,
+     * so tables would cost more to keep valid than the reads they replace.
+     *
      * @tparam Func `(Tile&)->bool`
      */
     template <typename Func>
@@ -0,0 +1,15 @@
+#ifndef WORLDFILE_H
+#define WORLDFILE_H
+
+class Random;
+class World;
+class Writer;
+struct Config;
+
+/**
+ * Serialize the world in Terraria's .wld format. Per-world details not
+ * decided during generation (NPCs, styles, backgrounds) are drawn from rnd.
+ */
+void putWorldFile(Writer &w, const Config &conf, Random &rnd, World &world);
+
+#endif // WORLDFILE_H
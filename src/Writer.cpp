@@ -1,26 +1,56 @@
 #include "Writer.h"
 
+#include "Gzip.h"
+#include <algorithm>
 #include <bit>
+#include <cstring>
+#include <fstream>
+#include <iostream>
 
 namespace
 {
 
 template <typename NumberType, size_t byteCount>
-void writeLittleEndian(std::ostream &out, NumberType val)
+void writeLittleEndian(char *out, NumberType val)
 {
-    for (size_t i = 0; i < byteCount; ++i) {
-        out.put(0xff & val);
-        val >>= 8;
+    if constexpr (std::endian::native == std::endian::little) {
+        std::memcpy(out, &val, byteCount);
+    } else {
+        for (size_t i = 0; i < byteCount; ++i) {
+            out[i] = 0xff & val;
+            val >>= 8;
+        }
     }
 }
 
 } // namespace
 
-Writer::Writer(const std::string &filename) : out(filename, std::ios::binary) {}
+Writer::Writer() : compressed(false), length(0), pos(0) {}
+
+Writer::Writer(
+    const std::string &filename,
+    size_t expectedSize,
+    bool compressed)
+    : filename(filename), compressed(compressed), buffer(expectedSize),
+      length(0), pos(0)
+{
+}
+
+Writer::~Writer()
+{
+    if (!filename.empty()) {
+        flush();
+    }
+}
+
+void Writer::grow(size_t minSize)
+{
+    buffer.resize(std::max(minSize, 2 * buffer.size()));
+}
 
 void Writer::putBool(bool val)
 {
-    out.put(val ? 1 : 0);
+    *claim(1) = val ? 1 : 0;
 }
 
 void Writer::putFloat32(float32_t val)
@@ -28,7 +58,7 @@ void Writer::putFloat32(float32_t val)
     if constexpr (std::endian::native == std::endian::big) {
         putUint32(std::bit_cast<std::uint32_t>(val));
     } else {
-        out.write(reinterpret_cast<const char *>(&val), sizeof(float32_t));
+        std::memcpy(claim(sizeof(float32_t)), &val, sizeof(float32_t));
     }
 }
 
@@ -37,7 +67,7 @@ void Writer::putFloat64(float64_t val)
     if constexpr (std::endian::native == std::endian::big) {
         putUint64(std::bit_cast<std::uint64_t>(val));
     } else {
-        out.write(reinterpret_cast<const char *>(&val), sizeof(float64_t));
+        std::memcpy(claim(sizeof(float64_t)), &val, sizeof(float64_t));
     }
 }
 
@@ -51,49 +81,80 @@ void Writer::putString(const std::string &val)
         if (len != 0) {
             b |= 0x80;
         }
-        out.put(b);
+        *claim(1) = b;
     } while (len != 0);
-    out.write(val.c_str(), val.size());
+    write(val.c_str(), val.size());
 }
 
 void Writer::putUint8(uint8_t val)
 {
-    out.put(val);
+    *claim(1) = val;
 }
 
 void Writer::putUint16(uint16_t val)
 {
-    writeLittleEndian<uint16_t, 2>(out, val);
+    writeLittleEndian<uint16_t, 2>(claim(2), val);
 }
 
 void Writer::putUint32(uint32_t val)
 {
-    writeLittleEndian<uint32_t, 4>(out, val);
+    writeLittleEndian<uint32_t, 4>(claim(4), val);
 }
 
 void Writer::putUint64(uint64_t val)
 {
-    writeLittleEndian<uint64_t, 8>(out, val);
+    writeLittleEndian<uint64_t, 8>(claim(8), val);
 }
 
 void Writer::skipBytes(size_t len)
 {
-    for (size_t i = 0; i < len; ++i) {
-        out.put(0);
-    }
+    std::memset(claim(len), 0, len);
 }
 
-void Writer::seekp(uint32_t pos)
+void Writer::seekp(uint32_t newPos)
 {
-    out.seekp(pos);
+    pos = newPos;
 }
 
 uint32_t Writer::tellp()
 {
-    return out.tellp();
+    return pos;
 }
 
 void Writer::write(const char *val, size_t len)
 {
-    out.write(val, len);
+    if (len > 0) {
+        std::memcpy(claim(len), val, len);
+    }
+}
+
+void Writer::append(const Writer &other)
+{
+    write(other.buffer.data(), other.length);
+}
+
+void Writer::writeTo(std::ostream &out) const
+{
+    if (compressed) {
+        GzipWriter gz(out);
+        gz.write(buffer.data(), length);
+        gz.finish();
+    } else {
+        out.write(buffer.data(), length);
+    }
+}
+
+bool Writer::flush()
+{
+    std::ofstream out;
+    // Unbuffered, so raw output goes out in a single write call.
+    out.rdbuf()->pubsetbuf(nullptr, 0);
+    out.open(filename, std::ios::binary);
+    writeTo(out);
+    out.close();
+    if (!out) {
+        std::cout << "Failed to write '" << filename << "'\n";
+    }
+    filename.clear();
+    return static_cast<bool>(out);
 }
@@ -4,24 +4,66 @@
 #include "vendor/ieee754_types.hpp"
 #include <bitset>
 #include <cstdint>
-#include <fstream>
+#include <ostream>
+#include <string>
+#include <vector>
 
 typedef IEEE_754::_2008::Binary<32> float32_t;
 typedef IEEE_754::_2008::Binary<64> float64_t;
 
+/**
+ * Serializes into an in-memory buffer, then saves the result to a file in a
+ * single write when flushed or destroyed. Writers constructed without a
+ * filename only buffer, for assembling parts to append to another Writer or
+ * for output with writeTo().
+ */
 class Writer
 {
 private:
-    std::ofstream out;
+    std::string filename;
+    bool compressed;
+    std::vector<char> buffer;
+    size_t length;
+    size_t pos;
+
+    void grow(size_t minSize);
+
+    /**
+     * Reserve len bytes at the current position, advancing past them.
+     */
+    char *claim(size_t len)
+    {
+        if (pos + len > buffer.size()) [[unlikely]] {
+            grow(pos + len);
+        }
+        char *ptr = buffer.data() + pos;
+        pos += len;
+        if (pos > length) {
+            length = pos;
+        }
+        return ptr;
+    }
 
 public:
-    Writer(const std::string &filename);
+    Writer();
+    /**
+     * @param expectedSize Initial buffer capacity, in bytes.
+     * @param compressed Save as a gzip stream instead of raw bytes.
+     */
+    Writer(
+        const std::string &filename,
+        size_t expectedSize = 0,
+        bool compressed = false);
+    ~Writer();
+
+    Writer(const Writer &) = delete;
+    Writer &operator=(const Writer &) = delete;
 
     template <size_t N> void putBitVec(std::bitset<N> vec)
     {
         std::bitset<N> mask(0xff);
         for (int i = (vec.size() + 7) / 8; i > 0; --i) {
-            out.put((vec & mask).to_ulong());
+            *claim(1) = (vec & mask).to_ulong();
             vec >>= 8;
         }
     }
@@ -35,9 +77,30 @@ public:
     void putUint32(uint32_t val);
     void putUint64(uint64_t val);
     void skipBytes(size_t len);
+    /**
+     * Move the write position within already written data, for patching
+     * earlier fields in place.
+     */
     void seekp(uint32_t pos);
     uint32_t tellp();
     void write(const char *val, size_t len);
+    /**
+     * Append everything buffered in other.
+     */
+    void append(const Writer &other);
+
+    /**
+     * Write buffered contents to the stream, gzip compressed if enabled.
+     */
+    void writeTo(std::ostream &out) const;
+
+    /**
+     * Save buffered contents to the file. Called automatically on
+     * destruction.
+     *
+     * @return False if the file could not be written.
+     */
+    bool flush();
 };
 
 #endif // WRITER_H
@@ -77,10 +77,10 @@ void registerSnow(Random &rnd, World &world)
     }
     double snowFloor =
         (world.getCavernLevel() + 2 * world.getUnderworldLevel()) / 3;
+    int minX = std::max<int>(center - scanDist, 0);
+    int maxX = std::min<int>(center + scanDist, world.getWidth());
     parallelFor(
-        std::views::iota(
-            std::max<int>(center - scanDist, 0),
-            std::min<int>(center + scanDist, world.getWidth())),
+        std::views::iota(minX, maxX),
         [center, snowFloor, &rnd, &world](int x) {
             for (int y = 0; y < world.getUnderworldLevel(); ++y) {
                 double threshold = std::max(
@@ -94,6 +94,7 @@ void registerSnow(Random &rnd, World &world)
                 }
             }
         });
+    world.invalidateBiomeSums(minX, 0, maxX - minX, world.getHeight());
 }
 
 void registerDesert(Random &rnd, World &world)
@@ -107,10 +108,10 @@ void registerDesert(Random &rnd, World &world)
     }
     double desertFloor =
         (world.getCavernLevel() + 4 * world.getUnderworldLevel()) / 5;
+    int minX = std::max<int>(center - scanDist, 0);
+    int maxX = std::min<int>(center + scanDist, world.getWidth());
     parallelFor(
-        std::views::iota(
-            std::max<int>(center - scanDist, 0),
-            std::min<int>(center + scanDist, world.getWidth())),
+        std::views::iota(minX, maxX),
         [center, desertFloor, &rnd, &world](int x) {
             for (int y = 0; y < world.getUnderworldLevel(); ++y) {
                 double threshold = std::max(
@@ -124,6 +125,7 @@ void registerDesert(Random &rnd, World &world)
                 }
             }
         });
+    world.invalidateBiomeSums(minX, 0, maxX - minX, world.getHeight());
 }
 
 void registerJungle(Random &rnd, World &world)
@@ -134,10 +136,10 @@ void registerJungle(Random &rnd, World &world)
     if (scanDist < 240) {
         scanDist += 25;
     }
+    int minX = std::max<int>(center - scanDist, 0);
+    int maxX = std::min<int>(center + scanDist, world.getWidth());
     parallelFor(
-        std::views::iota(
-            std::max<int>(center - scanDist, 0),
-            std::min<int>(center + scanDist, world.getWidth())),
+        std::views::iota(minX, maxX),
         [center, &rnd, &world](int x) {
             double threshold =
                 std::abs(x - center) / 100.0 -
@@ -153,6 +155,7 @@ void registerJungle(Random &rnd, World &world)
                 }
             }
         });
+    world.invalidateBiomeSums(minX, 0, maxX - minX, world.getHeight());
 }
 
 void registerUnderworld(Random &rnd, World &world)
@@ -165,13 +168,14 @@ void registerUnderworld(Random &rnd, World &world)
             BiomeData &biome = world.getBiome(x, y);
             biome.forest = std::clamp(
                 1 - biome.snow - biome.desert - biome.jungle,
-                0.0,
-                1.0);
+                0.0f,
+                1.0f);
         }
         for (int y = underworldLevel; y < world.getHeight(); ++y) {
             world.getBiome(x, y) = {Biome::underworld, 0.0, 0.0, 0.0, 0.0, 1.0};
         }
     });
+    world.invalidateBiomeSums(0, 0, world.getWidth(), world.getHeight());
 }
 
 double computeStoneThreshold(int y, World &world)
@@ -538,7 +542,9 @@ void applyBaseTerrain(Random &rnd, World &world)
             }
         });
 
-    parallelFor(std::views::iota(0, world.getWidth()), [&rnd, &world](int x) {
+    // Removing isolated blocks changes which neighbors are exposed, so columns
+    // run in order to keep the result independent of thread count.
+    for (int x = 0; x < world.getWidth(); ++x) {
         int stalactiteLen = 0;
         int stalacIter = 0;
         int cavernGrassLevel =
@@ -600,7 +606,7 @@ void applyBaseTerrain(Random &rnd, World &world)
                 }
             }
         }
-    });
+    }
 }
 
 void genWorldBase(Random &rnd, World &world)
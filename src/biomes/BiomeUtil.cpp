@@ -5,6 +5,7 @@
 #include "structures/StructureUtil.h"
 #include "vendor/frozen/map.h"
 #include <algorithm>
+#include <limits>
 
 double computeOreThreshold(double oreMultiplier)
 {
@@ -69,13 +70,13 @@ void doEmbedWaterfalls(
         }
     }
     std::shuffle(waterSources.begin(), waterSources.end(), rnd.getPRNG());
-    std::vector<Point> usedLocations;
+    LocationIndex usedLocations;
     std::vector<Point> waterStream;
     for (auto [x, y, deltaX] : waterSources) {
         if (isLocationUsed(x, y, proximity, usedLocations)) {
             continue;
         }
-        usedLocations.emplace_back(x, y);
+        usedLocations.insert({x, y});
         Tile &sourceTile = world.getTile(x, y);
         sourceTile.blockID = TileID::empty;
         sourceTile.liquid = liquid;
@@ -151,72 +152,153 @@ void fillLargeWallGaps(Point from, Point to, Random &rnd, World &world)
     }
 }
 
-Point findStoneCave(int yMin, int yMax, Random &rnd, World &world, int minSize)
-{
-    return findCave(yMin, yMax, rnd, world, minSize, {TileID::stone});
-}
-
-Point findCave(
+CaveIndex::CaveIndex(
     int yMin,
     int yMax,
-    Random &rnd,
     World &world,
-    int minSize,
     std::initializer_list<int> allowedBlocks)
+    : world(world), blocks(allowedBlocks)
 {
-    std::set<int> blocks{allowedBlocks.begin(), allowedBlocks.end()};
-    for (int numTries = 0; numTries < 5000; ++numTries) {
-        if (numTries % 100 == 99 && minSize > 3) {
-            // Slowly reduce size requirements if finding a cave is taking too
-            // long.
-            --minSize;
-        }
-        ++numTries;
-        int x = rnd.getInt(50, world.getWidth() - 50);
-        int y = rnd.getInt(yMin, yMax);
-        if (world.getTile(x, y).blockID != TileID::empty) {
-            continue;
-        }
-        // Scan up.
-        int caveRoof = y - 1;
-        while (caveRoof > 0 &&
-               world.getTile(x, caveRoof).blockID == TileID::empty) {
-            --caveRoof;
-        }
-        if (!blocks.contains(world.getTile(x, caveRoof).blockID)) {
-            continue;
-        }
-        // Scan down.
-        int caveFloor = y + 1;
-        while (caveFloor < world.getHeight() &&
-               world.getTile(x, caveFloor).blockID == TileID::empty) {
-            ++caveFloor;
+    int width = world.getWidth();
+    int height = world.getHeight();
+    yMin = std::max(yMin, 0);
+    yMax = std::min(yMax, height - 1);
+    int numRows = yMax - yMin + 1;
+    if (numRows <= 0) {
+        return;
+    }
+    // Vertical extent of each band cell, row major. Zero if the run does not
+    // end on allowed blocks.
+    std::vector<int> heights(static_cast<size_t>(numRows) * width);
+    // Start of the open horizontal run in each row, or -1.
+    std::vector<int> runStarts(numRows, -1);
+    auto closeRun = [&](int row, int runStart, int right, int rightBlock) {
+        if (runStart == 0 || !blocks.contains(rightBlock) ||
+            !blocks.contains(world.getTile(runStart - 1, row + yMin).blockID)) {
+            return;
         }
-        if (!blocks.contains(world.getTile(x, caveFloor).blockID) ||
-            caveFloor - caveRoof < minSize ||
-            caveFloor - caveRoof > minSize + 50) {
-            continue;
+        int runWidth = right - runStart + 1;
+        int maxX = std::min(right - 1, width - 50);
+        for (int x = std::max(runStart, 50); x <= maxX; ++x) {
+            int runHeight = heights[x + static_cast<size_t>(row) * width];
+            if (runHeight > 0) {
+                candidates.push_back({x, row + yMin, runHeight, runWidth});
+            }
         }
-        // Scan left.
-        int left = x - 1;
-        while (left > 0 && world.getTile(left, y).blockID == TileID::empty) {
-            --left;
+    };
+    for (int x = 0; x < width; ++x) {
+        std::span<Tile> column = world.column(x);
+        int y = yMin;
+        while (y <= yMax) {
+            if (column[y].blockID != TileID::empty) {
+                ++y;
+                continue;
+            }
+            int top = y;
+            while (top > 0 && column[top - 1].blockID == TileID::empty) {
+                --top;
+            }
+            int bottom = y;
+            while (bottom + 1 < height &&
+                   column[bottom + 1].blockID == TileID::empty) {
+                ++bottom;
+            }
+            if (top > 0 && bottom + 1 < height &&
+                blocks.contains(column[top - 1].blockID) &&
+                blocks.contains(column[bottom + 1].blockID)) {
+                int runHeight = bottom - top + 2;
+                for (int j = y; j <= std::min(bottom, yMax); ++j) {
+                    heights[x + static_cast<size_t>(j - yMin) * width] =
+                        runHeight;
+                }
+            }
+            y = bottom + 1;
         }
-        if (!blocks.contains(world.getTile(left, y).blockID)) {
-            continue;
+        for (int row = 0; row < numRows; ++row) {
+            int blockID = column[row + yMin].blockID;
+            if (blockID == TileID::empty) {
+                if (runStarts[row] == -1) {
+                    runStarts[row] = x;
+                }
+            } else if (runStarts[row] != -1) {
+                closeRun(row, runStarts[row], x, blockID);
+                runStarts[row] = -1;
+            }
         }
-        // Scan right.
-        int right = x + 1;
-        while (right < world.getWidth() &&
-               world.getTile(right, y).blockID == TileID::empty) {
-            ++right;
+    }
+}
+
+Point CaveIndex::measure(int x, int y, int minSize) const
+{
+    if (world.getTile(x, y).blockID != TileID::empty) {
+        return {-1, -1};
+    }
+    // Scan up.
+    int caveRoof = y - 1;
+    while (caveRoof > 0 &&
+           world.getTile(x, caveRoof).blockID == TileID::empty) {
+        --caveRoof;
+    }
+    if (!blocks.contains(world.getTile(x, caveRoof).blockID)) {
+        return {-1, -1};
+    }
+    // Scan down.
+    int caveFloor = y + 1;
+    while (caveFloor < world.getHeight() &&
+           world.getTile(x, caveFloor).blockID == TileID::empty) {
+        ++caveFloor;
+    }
+    if (!blocks.contains(world.getTile(x, caveFloor).blockID) ||
+        caveFloor - caveRoof < minSize || caveFloor - caveRoof > minSize + 50) {
+        return {-1, -1};
+    }
+    // Scan left.
+    int left = x - 1;
+    while (left > 0 && world.getTile(left, y).blockID == TileID::empty) {
+        --left;
+    }
+    if (!blocks.contains(world.getTile(left, y).blockID)) {
+        return {-1, -1};
+    }
+    // Scan right.
+    int right = x + 1;
+    while (right < world.getWidth() &&
+           world.getTile(right, y).blockID == TileID::empty) {
+        ++right;
+    }
+    if (!blocks.contains(world.getTile(right, y).blockID) ||
+        right - left < minSize || right - left > minSize + 50) {
+        return {-1, -1};
+    }
+    return {(left + right) / 2, (caveFloor + caveRoof) / 2};
+}
+
+Point CaveIndex::find(int yMin, int yMax, int minSize, Random &rnd)
+{
+    if (yMin != matchMinY || yMax != matchMaxY || minSize != matchMinSize) {
+        matchMinY = yMin;
+        matchMaxY = yMax;
+        matchMinSize = minSize;
+        matches.clear();
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            const Candidate &cand = candidates[i];
+            if (cand.y >= yMin && cand.y <= yMax && cand.height >= minSize &&
+                cand.height <= minSize + 50 && cand.width >= minSize &&
+                cand.width <= minSize + 50) {
+                matches.push_back(i);
+            }
         }
-        if (!blocks.contains(world.getTile(right, y).blockID) ||
-            right - left < minSize || right - left > minSize + 50) {
-            continue;
+    }
+    while (!matches.empty()) {
+        int idx = rnd.getInt(0, matches.size() - 1);
+        const Candidate &cand = candidates[matches[idx]];
+        Point center = measure(cand.x, cand.y, minSize);
+        if (center.x != -1) {
+            return center;
         }
-        // Success.
-        return {(left + right) / 2, (caveFloor + caveRoof) / 2};
+        // Filled in since the index was built.
+        matches[idx] = matches.back();
+        matches.pop_back();
     }
     return {-1, -1};
 }
@@ -283,33 +365,54 @@ void growMossOn(int x, int y, World &world)
 
 bool isInBiome(int x, int y, int scanDist, Biome biome, World &world)
 {
-    double threshold = 2 * scanDist;
-    threshold *= threshold;
-    threshold *= 0.05;
-    for (int i = -scanDist; i < scanDist; ++i) {
-        for (int j = -scanDist; j < scanDist; ++j) {
-            switch (biome) {
-            case Biome::forest:
-                threshold += world.getBiome(x + i, y + j).forest;
-                break;
-            case Biome::snow:
-                threshold += world.getBiome(x + i, y + j).snow;
-                break;
-            case Biome::desert:
-                threshold += world.getBiome(x + i, y + j).desert;
-                break;
-            case Biome::jungle:
-                threshold += world.getBiome(x + i, y + j).jungle;
-                break;
-            case Biome::underworld:
-                threshold += world.getBiome(x + i, y + j).underworld;
-                break;
-            }
-            threshold -= 1;
-            if (threshold < 0) {
-                return false;
-            }
-        }
+    if (scanDist <= 0) {
+        return true;
+    }
+    // Weights are at most 1, so the running total of (weight - 1) only
+    // decreases. Checking the window total is equivalent to checking every
+    // partial total.
+    double area = 2 * scanDist;
+    area *= area;
+    double threshold = 0.05 * area;
+    threshold += world.getBiomeSum(
+                     biome,
+                     x - scanDist,
+                     y - scanDist,
+                     2 * scanDist,
+                     2 * scanDist) -
+                 area;
+    return threshold >= 0;
+}
+
+namespace detail
+{
+ZoneMarks::ZoneMarks()
+    : height(0), minX(std::numeric_limits<int>::max()),
+      maxX(std::numeric_limits<int>::min())
+{
+}
+
+ZoneMarks &ZoneMarks::get(World &world)
+{
+    thread_local ZoneMarks marks;
+    size_t numTiles = static_cast<size_t>(world.getWidth()) * world.getHeight();
+    if (marks.height != world.getHeight() ||
+        64 * marks.bits.size() < numTiles) {
+        marks.bits.assign((numTiles + 63) / 64, 0);
+        marks.height = world.getHeight();
+    }
+    return marks;
+}
+
+void ZoneMarks::clear()
+{
+    if (minX > maxX) {
+        return;
     }
-    return true;
+    size_t begin = static_cast<size_t>(minX) * height / 64;
+    size_t end = (static_cast<size_t>(maxX + 1) * height + 63) / 64;
+    std::fill(bits.begin() + begin, bits.begin() + end, 0);
+    minX = std::numeric_limits<int>::max();
+    maxX = std::numeric_limits<int>::min();
 }
+} // namespace detail
@@ -1,7 +1,10 @@
 #ifndef BIOMEUTIL_H
 #define BIOMEUTIL_H
 
+#include "Util.h"
 #include "World.h"
+#include <algorithm>
+#include <cstdint>
 #include <set>
 
 class Random;
@@ -31,23 +34,50 @@ void embedWaterfalls(
 void fillLargeWallGaps(Point from, Point to, Random &rnd, World &world);
 
 /**
- * Find an open stone surrounded space. May reduce size restriction if searching
- * takes too long.
+ * Open spaces in a band of rows, measured once. An empty cell is a cave
+ * candidate when both its vertical and horizontal runs of empty tiles end on
+ * allowed blocks; find() samples among candidates of the requested size.
+ *
+ * The index does not see tiles carved after construction. Tiles filled since
+ * then are caught when a sampled candidate is re-measured against the world.
  */
-Point findStoneCave(
-    int yMin,
-    int yMax,
-    Random &rnd,
-    World &world,
-    int minSize = 6);
+class CaveIndex
+{
+private:
+    struct Candidate {
+        int x;
+        int y;
+        int height;
+        int width;
+    };
 
-Point findCave(
-    int yMin,
-    int yMax,
-    Random &rnd,
-    World &world,
-    int minSize,
-    std::initializer_list<int> allowedBlocks);
+    World &world;
+    std::set<int> blocks;
+    std::vector<Candidate> candidates;
+    /**
+     * Candidates matching the most recent find() query.
+     */
+    std::vector<uint32_t> matches;
+    int matchMinY = -1;
+    int matchMaxY = -1;
+    int matchMinSize = -1;
+
+    Point measure(int x, int y, int minSize) const;
+
+public:
+    CaveIndex(
+        int yMin,
+        int yMax,
+        World &world,
+        std::initializer_list<int> allowedBlocks = {TileID::stone});
+
+    /**
+     * Pick the center of a random cave in [yMin, yMax] whose vertical and
+     * horizontal extents are within [minSize, minSize + 50]. Returns {-1, -1}
+     * once no candidate qualifies.
+     */
+    Point find(int yMin, int yMax, int minSize, Random &rnd);
+};
 
 Point getHexCentroid(Point pt, int scale);
 Point getHexCentroid(int x, int y, int scale);
@@ -76,35 +106,164 @@ void iterateDiamond(int topHeight, int centerHeight, Func f)
     }
 }
 
+namespace detail
+{
 /**
+ * Visit marks for zone flood fills, one bit per world tile. Stored column major
+ * (matching world tiles), and reused between fills on the same thread.
+ */
+class ZoneMarks
+{
+private:
+    std::vector<uint64_t> bits;
+    int height;
+    int minX;
+    int maxX;
+
+    ZoneMarks();
+
+public:
+    static ZoneMarks &get(World &world);
+
+    /**
+     * Mark a location. Returns false if it was already marked.
+     */
+    bool mark(int x, int y)
+    {
+        size_t idx = y + static_cast<size_t>(x) * height;
+        uint64_t bit = uint64_t{1} << (idx % 64);
+        if (bits[idx / 64] & bit) {
+            return false;
+        }
+        bits[idx / 64] |= bit;
+        minX = std::min(minX, x);
+        maxX = std::max(maxX, x);
+        return true;
+    }
+
+    /**
+     * Unmark every location. Only columns marked since the last clear are
+     * touched.
+     */
+    void clear();
+};
+
+/**
+ * Vertical run of zone tiles, [top, bottom] inclusive.
+ */
+struct ZoneSpan {
+    int x;
+    int top;
+    int bottom;
+
+    auto operator<=>(const ZoneSpan &) const = default;
+};
+
+/**
+ * Scanline flood fill. Each location is tested with isValid at most once.
+ * Returns the zone as column spans, sorted by x, then y.
+ */
+template <typename BoundsCheck>
+std::vector<ZoneSpan> fillZone(Point start, World &world, BoundsCheck isValid)
+{
+    std::vector<ZoneSpan> spans;
+    if (start.x < 0 || start.y < 0 || start.x >= world.getWidth() ||
+        start.y >= world.getHeight()) {
+        return spans;
+    }
+    ZoneMarks &marks = ZoneMarks::get(world);
+    marks.mark(start.x, start.y);
+    if (!isValid(start)) {
+        marks.clear();
+        return spans;
+    }
+    // Pending runs, already validated, still to be extended vertically.
+    std::vector<ZoneSpan> pending{{start.x, start.y, start.y}};
+    while (!pending.empty()) {
+        auto [x, top, bottom] = pending.back();
+        pending.pop_back();
+        while (top > 0 && marks.mark(x, top - 1) && isValid({x, top - 1})) {
+            --top;
+        }
+        while (bottom + 1 < world.getHeight() && marks.mark(x, bottom + 1) &&
+               isValid({x, bottom + 1})) {
+            ++bottom;
+        }
+        spans.push_back({x, top, bottom});
+        for (int nextX : {x - 1, x + 1}) {
+            if (nextX < 0 || nextX >= world.getWidth()) {
+                continue;
+            }
+            bool inRun = false;
+            for (int y = top; y <= bottom; ++y) {
+                if (marks.mark(nextX, y) && isValid({nextX, y})) {
+                    if (inRun) {
+                        pending.back().bottom = y;
+                    } else {
+                        pending.push_back({nextX, y, y});
+                        inRun = true;
+                    }
+                } else {
+                    inRun = false;
+                }
+            }
+        }
+    }
+    // Release marks before any callbacks run, so callbacks may start fills of
+    // their own.
+    marks.clear();
+    std::sort(spans.begin(), spans.end());
+    return spans;
+}
+} // namespace detail
+
+/**
+ * Call f on every location 4-connected to start that passes isValid, ordered
+ * by x, then y.
+ *
  * @tparam BoundsCheck `(Point)->bool`
  * @tparam Func `(Point)->void`
  */
 template <typename BoundsCheck, typename Func>
 void iterateZone(Point start, World &world, BoundsCheck isValid, Func f)
 {
-    std::set<Point> border;
-    std::set<Point> visited;
-    std::vector<Point> locations{start};
-    while (!locations.empty()) {
-        Point loc = locations.back();
-        locations.pop_back();
-        if (loc.x < 0 || loc.y < 0 || loc.x >= world.getWidth() ||
-            loc.y >= world.getHeight() || visited.contains(loc) ||
-            border.contains(loc)) {
-            continue;
-        }
-        if (isValid(loc)) {
-            visited.insert(loc);
-            for (auto delta : {Point{-1, 0}, {1, 0}, {0, -1}, {0, 1}}) {
-                locations.push_back(loc + delta);
-            }
-        } else {
-            border.insert(loc);
+    for (auto [x, top, bottom] : detail::fillZone(start, world, isValid)) {
+        for (int y = top; y <= bottom; ++y) {
+            f({x, y});
         }
     }
-    for (Point loc : visited) {
-        f(loc);
+}
+
+/**
+ * Like iterateZone, but zones larger than minParallelSize run f concurrently.
+ * Only use when f for one location does not depend on f for any other.
+ *
+ * @tparam BoundsCheck `(Point)->bool`
+ * @tparam Func `(Point)->void`
+ */
+template <typename BoundsCheck, typename Func>
+void parallelIterateZone(
+    Point start,
+    World &world,
+    BoundsCheck isValid,
+    Func f,
+    size_t minParallelSize = 4096)
+{
+    std::vector<detail::ZoneSpan> spans =
+        detail::fillZone(start, world, isValid);
+    size_t zoneSize = 0;
+    for (auto [x, top, bottom] : spans) {
+        zoneSize += bottom - top + 1;
+    }
+    auto applySpan = [&f](const detail::ZoneSpan &span) {
+        for (int y = span.top; y <= span.bottom; ++y) {
+            f({span.x, y});
+        }
+    };
+    if (zoneSize < minParallelSize) {
+        std::for_each(spans.begin(), spans.end(), applySpan);
+    } else {
+        parallelFor(spans, applySpan);
     }
 }
 
@@ -197,7 +197,7 @@ void growRoot(
     }
 }
 
-Point findDoor(TileBuffer &room)
+Point findDoor(const TileBuffer &room)
 {
     for (int i = 0; i < room.getWidth(); ++i) {
         for (int j = 0; j < room.getHeight(); ++j) {
@@ -503,7 +503,7 @@ void growLivingTrees(Random &rnd, World &world)
 void buryEnchantedSwords(Random &rnd, World &world)
 {
     double numSwords = world.getWidth() / rnd.getInt(1800, 3800);
-    std::vector<Point> usedLocations;
+    LocationIndex usedLocations;
     constexpr auto avoidTiles = frozen::make_set<int>(
         {TileID::empty,
          TileID::snow,
@@ -528,7 +528,7 @@ void buryEnchantedSwords(Random &rnd, World &world)
             numSwords -= 0.002;
             continue;
         }
-        usedLocations.emplace_back(x, y);
+        usedLocations.insert({x, y});
         for (int i = -15; i < 15; ++i) {
             for (int j = 3; j < 17; ++j) {
                 if (std::hypot(i, 17 - j) + 2 * rnd.getFineNoise(x + i, y + j) <
@@ -77,13 +77,17 @@ void genGemCave(Random &rnd, World &world)
         gemTypes.size();
     int numCaves =
         world.conf.gems * world.getWidth() * world.getHeight() / 900000;
+    CaveIndex caves(
+        world.getUndergroundLevel(),
+        world.getUndergroundLevel() + bandHeight * (gemTypes.size() - 1),
+        world);
     for (size_t band = 0; band + 1 < gemTypes.size(); ++band) {
         for (int i = 0; i < numCaves; ++i) {
-            auto [x, y] = findStoneCave(
+            auto [x, y] = caves.find(
                 world.getUndergroundLevel() + bandHeight * band,
                 world.getUndergroundLevel() + bandHeight * (band + 1),
-                rnd,
-                world);
+                6,
+                rnd);
             if (x != -1) {
                 fillGemCave(
                     x,
@@ -214,16 +214,18 @@ Point selectGemGroveLocation(double &groveSize, Random &rnd, World &world)
     int safeMaxY =
         (world.getCavernLevel() + 2 * world.getUnderworldLevel()) / 3;
     double shrink = groveSize / 10000.0;
+    int minY = world.conf.ascent ? world.getUndergroundLevel()
+                                 : world.getCavernLevel();
+    CaveIndex caves(
+        std::min(minY, safeMinY),
+        std::max(world.getUnderworldLevel(), safeMaxY),
+        world);
     for (int numTries = 0; numTries < 5000; ++numTries, groveSize -= shrink) {
-        auto [x, y] = findStoneCave(
-            std::min<int>(
-                (world.conf.ascent ? world.getUndergroundLevel()
-                                   : world.getCavernLevel()) +
-                    groveSize,
-                safeMinY),
+        auto [x, y] = caves.find(
+            std::min<int>(minY + groveSize, safeMinY),
             std::max<int>(world.getUnderworldLevel() - groveSize, safeMaxY),
-            rnd,
-            world);
+            6,
+            rnd);
         if (x < 75 + groveSize || x > world.getWidth() - 75 - groveSize) {
             continue;
         }
@@ -7,6 +7,7 @@
 #include "ids/WallID.h"
 #include "vendor/frozen/set.h"
 #include <iostream>
+#include <map>
 
 bool isSolidArea(int x, int y, int size, World &world)
 {
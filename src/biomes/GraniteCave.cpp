@@ -108,9 +108,9 @@ void genGraniteCave(Random &rnd, World &world)
                    : std::midpoint(
                          world.getUndergroundLevel(),
                          world.getCavernLevel());
+    CaveIndex caves(minY, world.getUnderworldLevel(), world);
     for (int i = 0; i < numCaves; ++i) {
-        auto [x, y] =
-            findStoneCave(minY, world.getUnderworldLevel(), rnd, world, 30);
+        auto [x, y] = caves.find(minY, world.getUnderworldLevel(), 30, rnd);
         if (x != -1) {
             fillGraniteCave(x, y, rnd, world);
         }
@@ -26,7 +26,7 @@ Point selectLarvaeLocation(
     int hiveX,
     int hiveY,
     int size,
-    std::vector<Point> &usedLocations,
+    LocationIndex &usedLocations,
     Random &rnd,
     World &world)
 {
@@ -136,13 +136,13 @@ void fillHive(int hiveX, int hiveY, double size, Random &rnd, World &world)
     world.queuedTreasures.addTask([hiveX,
                                    hiveY,
                                    size](Random &rnd, World &world) {
-        std::vector<Point> usedLocations;
+        LocationIndex usedLocations;
         for (int x = hiveX - size; x < hiveX + size; ++x) {
             for (int y = hiveY - size; y < hiveY + size; ++y) {
                 Tile &tile = world.getTile(x, y);
                 if (tile.blockID == TileID::larva && tile.frameX == 0 &&
                     tile.frameY == 0) {
-                    usedLocations.emplace_back(x, y);
+                    usedLocations.insert({x, y});
                 }
             }
         }
@@ -157,7 +157,7 @@ void fillHive(int hiveX, int hiveY, double size, Random &rnd, World &world)
                 rnd,
                 world);
             if (x != -1) {
-                usedLocations.emplace_back(x, y);
+                usedLocations.insert({x, y});
                 world.placeFramedTile(x, y - 2, TileID::larva);
             }
         }
@@ -78,20 +78,30 @@ void genMarbleCave(Random &rnd, World &world)
     int maxY = world.conf.biomes == BiomeLayout::layers && !world.conf.hiveQueen
                    ? 0.526 * world.getHeight()
                    : world.getUnderworldLevel();
+    CaveIndex stoneCaves(minY, maxY, world);
+    CaveIndex jungleCaves(
+        minY,
+        maxY,
+        world,
+        {TileID::stone,
+         TileID::snow,
+         TileID::ice,
+         TileID::sandstone,
+         TileID::jungleGrass});
+    CaveIndex desertCaves(
+        minY,
+        maxY,
+        world,
+        {TileID::stone,
+         TileID::snow,
+         TileID::ice,
+         TileID::sandstone,
+         TileID::hardenedSand});
     for (int i = 0; i < numCaves; ++i) {
-        auto [x, y] = i % 3 == 0 ? findStoneCave(minY, maxY, rnd, world, 30)
-                                 : findCave(
-                                       minY,
-                                       maxY,
-                                       rnd,
-                                       world,
-                                       30,
-                                       {TileID::stone,
-                                        TileID::snow,
-                                        TileID::ice,
-                                        TileID::sandstone,
-                                        i % 2 == 0 ? TileID::jungleGrass
-                                                   : TileID::hardenedSand});
+        CaveIndex &caves = i % 3 == 0   ? stoneCaves
+                           : i % 2 == 0 ? jungleCaves
+                                        : desertCaves;
+        auto [x, y] = caves.find(minY, maxY, 30, rnd);
         if (x != -1) {
             fillMarbleCave(x, y, rnd, world);
         }
@@ -145,11 +145,11 @@ void addOceanCave(int waterTable, Random &rnd, World &world)
     world.queuedTreasures.addTask(
         [locs = std::move(locations)](Random &rnd, World &world) {
             int numChests = std::max<int>(locs.size() / 100, 2);
-            std::vector<Point> usedLocations;
+            LocationIndex usedLocations;
             for (auto [x, y] : locs) {
                 if (canPlaceReefChest(x, y, world) &&
                     !isLocationUsed(x, y, 50, usedLocations)) {
-                    usedLocations.emplace_back(x, y);
+                    usedLocations.insert({x, y});
                     Chest &chest = world.placeChest(x, y, Variant::reef);
                     if (y < world.getCavernLevel()) {
                         fillWaterChest(chest, Depth::underground, rnd, world);
@@ -33,8 +33,9 @@ void genSpiderNest(Random &rnd, World &world)
                                  : world.getCavernLevel();
     int maxY = world.conf.ascent ? world.getCavernLevel()
                                  : world.getUnderworldLevel() - 20;
+    CaveIndex caves(minY, maxY, world);
     for (int i = 0; i < numNests; ++i) {
-        auto [x, y] = findStoneCave(minY, maxY, rnd, world);
+        auto [x, y] = caves.find(minY, maxY, 6, rnd);
         if (x != -1) {
             fillSpiderNest(x, y, rnd, world);
         }
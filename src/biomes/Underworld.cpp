@@ -15,8 +15,8 @@
 void copyTemplateTile(const Tile &from, Tile &to, int x, int y, Random &rnd)
 {
     if (from.wallID != WallID::empty) {
-        to.wallID =
-            from.wallID == WallID::Safe::cloud ? WallID::empty : from.wallID;
+        to.wallID = from.wallID == WallID::Safe::cloud ? WallID::empty
+                                                       : int{from.wallID};
         to.wallPaint = from.wallPaint;
     }
     if (from.blockID != TileID::empty) {
@@ -186,82 +186,76 @@ void genUnderworld(Random &rnd, World &world)
     if (world.conf.ascent) {
         makeIslandMoats(lavaLevel, rnd, world);
     }
-    parallelFor(
-        std::views::iota(0, world.getWidth()),
-        [aspectRatio,
-         centerLevel,
-         lavaLevel,
-         upperDist,
-         lowerDist,
-         &getIslandSurface,
-         &rnd,
-         &world](int x) {
-            int stalactiteLen =
-                std::max(0.0, 16 * rnd.getFineNoise(4 * x, aspectRatio * x));
-            bool foundRoof = false;
-            for (int y = centerLevel;
-                 y > world.getUnderworldLevel() && stalactiteLen < 10;
-                 --y) {
-                Tile &tile = world.getTile(x, y);
+    // Carving grows grass on the previous column and changes which tiles are
+    // exposed, so columns run in order to keep the result independent of thread
+    // count.
+    for (int x = 0; x < world.getWidth(); ++x) {
+        int stalactiteLen =
+            std::max(0.0, 16 * rnd.getFineNoise(4 * x, aspectRatio * x));
+        bool foundRoof = false;
+        for (int y = centerLevel;
+             y > world.getUnderworldLevel() && stalactiteLen < 10;
+             --y) {
+            Tile &tile = world.getTile(x, y);
+            if (tile.blockID == TileID::ash) {
+                foundRoof = true;
+            }
+            if (foundRoof) {
                 if (tile.blockID == TileID::ash) {
-                    foundRoof = true;
-                }
-                if (foundRoof) {
-                    if (tile.blockID == TileID::ash) {
-                        tile.blockID = TileID::empty;
-                        ++stalactiteLen;
-                    } else {
-                        break;
-                    }
+                    tile.blockID = TileID::empty;
+                    ++stalactiteLen;
+                } else {
+                    break;
                 }
             }
-            int islandSurface = getIslandSurface(x);
-            for (int y = world.getUnderworldLevel(); y < world.getHeight();
-                 ++y) {
-                Tile &tile = world.getTile(x, y);
-                if (y > islandSurface) {
-                    tile.blockID = TileID::ash;
-                    continue;
-                } else if (
-                    islandSurface < lavaLevel &&
-                    tile.blockID == TileID::hellstone) {
-                    tile.blockID = TileID::ash;
-                }
-                double threshold =
-                    0.25 - 0.25 * (y < centerLevel
-                                       ? (centerLevel - y) / upperDist
-                                       : (y - centerLevel) / lowerDist);
-                if (tile.blockID == TileID::hive &&
-                    rnd.getStableUint(x, y) % 7 == 0) {
-                    tile.blockID = TileID::crispyHoney;
-                }
-                if (std::abs(rnd.getCoarseNoise(2 * x, y + aspectRatio * x)) <
-                    threshold) {
-                    for (auto [i, j] : {std::pair{-1, -1}, {-1, 0}, {0, -1}}) {
-                        Tile &prevTile = world.getTile(x + i, y + j);
-                        if (prevTile.blockID == TileID::mud) {
-                            prevTile.blockID = TileID::jungleGrass;
-                        }
+        }
+        int islandSurface = getIslandSurface(x);
+        for (int y = world.getUnderworldLevel(); y < world.getHeight();
+             ++y) {
+            Tile &tile = world.getTile(x, y);
+            if (y > islandSurface) {
+                tile.blockID = TileID::ash;
+                continue;
+            } else if (
+                islandSurface < lavaLevel &&
+                tile.blockID == TileID::hellstone) {
+                tile.blockID = TileID::ash;
+            }
+            double threshold =
+                0.25 - 0.25 * (y < centerLevel
+                                   ? (centerLevel - y) / upperDist
+                                   : (y - centerLevel) / lowerDist);
+            if (tile.blockID == TileID::hive &&
+                rnd.getStableUint(x, y) % 7 == 0) {
+                tile.blockID = TileID::crispyHoney;
+            }
+            if (std::abs(rnd.getCoarseNoise(2 * x, y + aspectRatio * x)) <
+                threshold) {
+                for (auto [i, j] : {std::pair{-1, -1}, {-1, 0}, {0, -1}}) {
+                    Tile &prevTile = world.getTile(x + i, y + j);
+                    if (prevTile.blockID == TileID::mud) {
+                        prevTile.blockID = TileID::jungleGrass;
                     }
-                    tile.blockID = TileID::empty;
-                    tile.wallID = WallID::empty;
-                } else if (
-                    std::abs(rnd.getFineNoise(2 * x, 2 * y + aspectRatio * x)) <
-                        0.12 ||
-                    std::abs(rnd.getFineNoise(3 * x, 3 * y + aspectRatio * x)) <
-                        0.06) {
-                    tile.wallID = WallID::empty;
                 }
-                if (y > lavaLevel) {
-                    if (tile.blockID == TileID::empty) {
-                        tile.liquid = Liquid::lava;
-                    }
-                } else if (
-                    tile.blockID == TileID::mud && world.isExposed(x, y)) {
-                    tile.blockID = TileID::jungleGrass;
+                tile.blockID = TileID::empty;
+                tile.wallID = WallID::empty;
+            } else if (
+                std::abs(rnd.getFineNoise(2 * x, 2 * y + aspectRatio * x)) <
+                    0.12 ||
+                std::abs(rnd.getFineNoise(3 * x, 3 * y + aspectRatio * x)) <
+                    0.06) {
+                tile.wallID = WallID::empty;
+            }
+            if (y > lavaLevel) {
+                if (tile.blockID == TileID::empty) {
+                    tile.liquid = Liquid::lava;
                 }
+            } else if (
+                tile.blockID == TileID::mud && world.isExposed(x, y)) {
+                tile.blockID = TileID::jungleGrass;
             }
-        });
+        }
+    }
     addBridges(centerLevel, lavaLevel, rnd, world);
     int skipFrom = 0.15 * world.getWidth();
     int skipTo = 0.85 * world.getWidth();
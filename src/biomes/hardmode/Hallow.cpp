@@ -11,6 +11,7 @@
 #include "vendor/frozen/map.h"
 #include "vendor/frozen/set.h"
 #include <iostream>
+#include <map>
 
 int selectHallowLocation(Random &rnd, World &world)
 {
@@ -130,41 +130,39 @@ void genHardmodeOres(Random &rnd, World &world)
         TileID::stone,
     });
     std::array<DepositDef, 3> depositNoise = getHmOreLayers(rnd, world);
-    parallelFor(
-        std::views::iota(0, world.getWidth()),
-        [chlorophyteThreshold = computeOreThreshold(0.7 * world.conf.ore),
-         oreThreshold = computeOreThreshold(0.9 * world.conf.ore),
-         &clearableTiles,
-         &depositNoise,
-         &rnd,
-         &world](int x) {
-            for (int y = 0; y < world.getHeight(); ++y) {
-                Tile &tile = world.getTile(x, y);
-                if (!clearableTiles.contains(tile.blockID) ||
-                    (y > world.getUnderworldLevel() &&
-                     tile.blockID == TileID::ash)) {
-                    continue;
-                }
-                if (y > world.getUndergroundLevel() &&
-                    rnd.getFineNoise(x, y) < chlorophyteThreshold) {
-                    if (tile.blockID == TileID::jungleGrass ||
-                        (tile.blockID == TileID::mud &&
-                         canSpawnChlorophyte(x, y, world))) {
-                        tile.blockID = TileID::chlorophyteOre;
-                        continue;
-                    }
-                }
-                if (rnd.getCoarseNoise(x, y) < 0.13) {
+    double chlorophyteThreshold = computeOreThreshold(0.7 * world.conf.ore);
+    double oreThreshold = computeOreThreshold(0.9 * world.conf.ore);
+    // Chlorophyte spreads from nearby chlorophyte and jungle grass, which
+    // earlier columns may have converted, so columns run in order to keep the
+    // result independent of thread count.
+    for (int x = 0; x < world.getWidth(); ++x) {
+        for (int y = 0; y < world.getHeight(); ++y) {
+            Tile &tile = world.getTile(x, y);
+            if (!clearableTiles.contains(tile.blockID) ||
+                (y > world.getUnderworldLevel() &&
+                 tile.blockID == TileID::ash)) {
+                continue;
+            }
+            if (y > world.getUndergroundLevel() &&
+                rnd.getFineNoise(x, y) < chlorophyteThreshold) {
+                if (tile.blockID == TileID::jungleGrass ||
+                    (tile.blockID == TileID::mud &&
+                     canSpawnChlorophyte(x, y, world))) {
+                    tile.blockID = TileID::chlorophyteOre;
                     continue;
                 }
-                for (const auto &row : depositNoise) {
-                    if (y > row.minY && y < row.maxY &&
-                        rnd.getFineNoise(x + row.noiseX, y + row.noiseY) <
-                            oreThreshold) {
-                        tile.blockID = row.ore;
-                        break;
-                    }
+            }
+            if (rnd.getCoarseNoise(x, y) < 0.13) {
+                continue;
+            }
+            for (const auto &row : depositNoise) {
+                if (y > row.minY && y < row.maxY &&
+                    rnd.getFineNoise(x + row.noiseX, y + row.noiseY) <
+                        oreThreshold) {
+                    tile.blockID = row.ore;
+                    break;
                 }
             }
-        });
+        }
+    }
 }
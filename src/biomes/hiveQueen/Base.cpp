@@ -148,6 +148,7 @@ std::vector<Point> planHiveQueenBiomes(Random &rnd, World &world)
             }
         }
     });
+    world.invalidateBiomeSums(0, 0, world.getWidth(), world.getHeight());
     if (world.conf.biomes != BiomeLayout::columns) {
         identifySurfaceBiomes(world);
     }
@@ -451,87 +452,90 @@ void genWorldBaseHiveQueen(Random &rnd, World &world)
         });
 
     std::cout << "Generating honeycomb\n";
-    parallelFor(
-        std::views::iota(0, world.getWidth()),
-        [lavaLevel, &rnd, &world](int x) {
-            auto valueLess = [](const std::pair<int, int> &a,
-                                const std::pair<int, int> &b) {
-                return a.second < b.second;
-            };
-            for (int y = 0; y < world.getHeight(); ++y) {
-                if (world.getTile(x, y).wireBlue) {
-                    continue;
-                }
-                std::vector<Point> locations;
-                std::map<int, int> tiles;
-                std::map<int, int> walls;
-                iterateHex(
-                    {x, y},
-                    10,
-                    [&locations, &tiles, &walls, &world](Point pt) {
-                        if (pt.x < 0 || pt.y < 0 || pt.x >= world.getWidth() ||
-                            pt.y >= world.getHeight()) {
-                            return;
-                        }
-                        locations.push_back(pt);
-                        Tile &tile = world.getTile(pt);
-                        tiles[tile.wireRed ? TileID::empty : tile.blockID] += 1;
-                        walls[tile.wallID] += 1;
-                    });
-                tiles[TileID::empty] *= 1.3;
-                if (y < world.getUndergroundLevel()) {
-                    walls[WallID::empty] *= 1.3;
+    // Cells span many columns and must each be filled from their original
+    // tiles, so columns run in order to keep the result independent of thread
+    // count.
+    auto valueLess = [](const std::pair<int, int> &a,
+                        const std::pair<int, int> &b) {
+        return a.second < b.second;
+    };
+    for (int x = 0; x < world.getWidth(); ++x) {
+        for (int y = 0; y < world.getHeight(); ++y) {
+            if (world.getTile(x, y).wireBlue) {
+                continue;
+            }
+            std::vector<Point> locations;
+            std::map<int, int> tiles;
+            std::map<int, int> walls;
+            iterateHex(
+                {x, y},
+                10,
+                [&locations, &tiles, &walls, &world](Point pt) {
+                    if (pt.x < 0 || pt.y < 0 || pt.x >= world.getWidth() ||
+                        pt.y >= world.getHeight()) {
+                        return;
+                    }
+                    locations.push_back(pt);
+                    Tile &tile = world.getTile(pt);
+                    int blockID =
+                        tile.wireRed ? TileID::empty : int{tile.blockID};
+                    tiles[blockID] += 1;
+                    walls[tile.wallID] += 1;
+                });
+            tiles[TileID::empty] *= 1.3;
+            if (y < world.getUndergroundLevel()) {
+                walls[WallID::empty] *= 1.3;
+            }
+            auto targTile =
+                std::max_element(tiles.begin(), tiles.end(), valueLess);
+            auto targWall =
+                std::max_element(walls.begin(), walls.end(), valueLess);
+            int threshold = std::max<int>(0.6 * locations.size(), 2);
+            if (targTile->second < threshold) {
+                targTile->second = -1;
+            } else {
+                int oreCount = 0;
+                for (auto ore :
+                     {TileID::copperOre,
+                      TileID::tinOre,
+                      TileID::ironOre,
+                      TileID::leadOre,
+                      TileID::silverOre,
+                      TileID::tungstenOre,
+                      TileID::goldOre,
+                      TileID::platinumOre,
+                      TileID::hellstone,
+                      TileID::desertFossil}) {
+                    oreCount += tiles[ore];
                 }
-                auto targTile =
-                    std::max_element(tiles.begin(), tiles.end(), valueLess);
-                auto targWall =
-                    std::max_element(walls.begin(), walls.end(), valueLess);
-                int threshold = std::max<int>(0.6 * locations.size(), 2);
-                if (targTile->second < threshold) {
+                if (oreCount < threshold &&
+                    oreCount > std::max(threshold / 4, 5)) {
                     targTile->second = -1;
-                } else {
-                    int oreCount = 0;
-                    for (auto ore :
-                         {TileID::copperOre,
-                          TileID::tinOre,
-                          TileID::ironOre,
-                          TileID::leadOre,
-                          TileID::silverOre,
-                          TileID::tungstenOre,
-                          TileID::goldOre,
-                          TileID::platinumOre,
-                          TileID::hellstone,
-                          TileID::desertFossil}) {
-                        oreCount += tiles[ore];
-                    }
-                    if (oreCount < threshold &&
-                        oreCount > std::max(threshold / 4, 5)) {
-                        targTile->second = -1;
-                    }
                 }
-                if (targWall->second < threshold) {
-                    targWall->second = -1;
+            }
+            if (targWall->second < threshold) {
+                targWall->second = -1;
+            }
+            Point centroid = getHexCentroid(x, y, 10);
+            int rndFlag = rnd.getStableUint(centroid.x, centroid.y) % 13;
+            Flag hexFlag = rndFlag > 5              ? Flag::orange
+                           : rndFlag > 1            ? Flag::yellow
+                           : centroid.y > lavaLevel ? Flag::crispyHoney
+                                                    : Flag::hive;
+            for (auto pt : locations) {
+                Tile &tile = world.getTile(pt);
+                tile.wireRed = false;
+                tile.wireBlue = true;
+                if (targTile->second > 0) {
+                    tile.blockID = targTile->first;
                 }
-                Point centroid = getHexCentroid(x, y, 10);
-                int rndFlag = rnd.getStableUint(centroid.x, centroid.y) % 13;
-                Flag hexFlag = rndFlag > 5              ? Flag::orange
-                               : rndFlag > 1            ? Flag::yellow
-                               : centroid.y > lavaLevel ? Flag::crispyHoney
-                                                        : Flag::hive;
-                for (auto pt : locations) {
-                    Tile &tile = world.getTile(pt);
-                    tile.wireRed = false;
-                    tile.wireBlue = true;
-                    if (targTile->second > 0) {
-                        tile.blockID = targTile->first;
-                    }
-                    if (targWall->second > 0) {
-                        tile.wallID = targWall->first;
-                    }
-                    tile.flag = hexFlag;
+                if (targWall->second > 0) {
+                    tile.wallID = targWall->first;
                 }
+                tile.flag = hexFlag;
             }
-        });
+        }
+    }
 
     parallelFor(std::views::iota(0, world.getWidth()), [&rnd, &world](int x) {
         int surfaceLevel =
@@ -6,6 +6,7 @@
 #include "biomes/BiomeUtil.h"
 #include "ids/WallID.h"
 #include <iostream>
+#include <map>
 #include <set>
 
 Point selectGlowingMossLocation(
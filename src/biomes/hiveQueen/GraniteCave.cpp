@@ -22,7 +22,7 @@ void fillGraniteCaveHex(int x, int y, World &world)
                 clearCenters.insert(centroid);
             }
         });
-    iterateZone(
+    parallelIterateZone(
         {x, y},
         world,
         [&world](Point pt) { return world.getTile(pt).flag != Flag::border; },
@@ -57,13 +57,11 @@ void genGraniteCaveHiveQueen(Random &rnd, World &world)
     int numCaves =
         world.conf.graniteFreq * world.getWidth() * world.getHeight() / 2000000;
     int scanDist = world.conf.graniteSize * 90;
+    int minY =
+        std::midpoint(world.getUndergroundLevel(), world.getCavernLevel());
+    CaveIndex caves(minY, world.getUnderworldLevel(), world);
     for (int iter = 0; iter < numCaves; ++iter) {
-        auto [x, y] = findStoneCave(
-            std::midpoint(world.getUndergroundLevel(), world.getCavernLevel()),
-            world.getUnderworldLevel(),
-            rnd,
-            world,
-            30);
+        auto [x, y] = caves.find(minY, world.getUnderworldLevel(), 30, rnd);
         if (x != -1 && world.getTile(x, y).flag != Flag::border) {
             fillGraniteCaveHex(x, y, world);
             for (int probes = world.conf.graniteSize * 20; probes > 0;
@@ -58,13 +58,11 @@ void genMarbleCaveHiveQueen(Random &rnd, World &world)
     std::cout << "Excavating marble\n";
     int numCaves =
         world.conf.marbleFreq * world.getWidth() * world.getHeight() / 1200000;
+    int minY =
+        std::midpoint(world.getUndergroundLevel(), world.getCavernLevel());
+    CaveIndex caves(minY, world.getUnderworldLevel(), world);
     for (int i = 0; i < numCaves; ++i) {
-        auto [x, y] = findStoneCave(
-            std::midpoint(world.getUndergroundLevel(), world.getCavernLevel()),
-            world.getUnderworldLevel(),
-            rnd,
-            world,
-            30);
+        auto [x, y] = caves.find(minY, world.getUnderworldLevel(), 30, rnd);
         if (x != -1 && world.getTile(x, y).flag != Flag::border) {
             fillMarbleCaveHex(x, y, rnd, world);
         }
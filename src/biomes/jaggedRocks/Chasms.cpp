@@ -53,7 +53,7 @@ void genChasms(Random &rnd, World &world)
 {
     std::cout << "Fracturing land\n";
     rnd.shuffleNoise();
-    std::vector<Point> usedLocations{
+    LocationIndex usedLocations{
         {125, world.getSurfaceLevel(125)},
         {world.getWidth() - 125,
          world.getSurfaceLevel(world.getWidth() - 125)}};
@@ -72,7 +72,7 @@ void genChasms(Random &rnd, World &world)
             isLocationUsed(x, y, 200, usedLocations)) {
             continue;
         }
-        usedLocations.emplace_back(x, y);
+        usedLocations.insert({x, y});
         --numChasms;
         genChasmAt(
             {x, y},
@@ -82,7 +82,10 @@ void genChasms(Random &rnd, World &world)
             world);
     }
 
-    parallelFor(std::views::iota(0, world.getWidth()), [&rnd, &world](int x) {
+    // Each column lags one behind, growing grass in column x - 1 once column x
+    // is cleared, so columns run in order to keep the result independent of
+    // thread count.
+    for (int x = 0; x < world.getWidth(); ++x) {
         int maxWallClear = std::midpoint(
             world.getSurfaceLevel(x),
             world.getUndergroundLevel());
@@ -133,5 +136,5 @@ void genChasms(Random &rnd, World &world)
                 }
             }
         }
-    });
+    }
 }
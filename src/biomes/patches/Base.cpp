@@ -88,7 +88,13 @@ BiomeData computeBiomeData(int x, int y, Random &rnd)
             }
         }
     }
-    return {active, forest, snow, desert, jungle, underworld};
+    return {
+        active,
+        static_cast<float>(forest),
+        static_cast<float>(snow),
+        static_cast<float>(desert),
+        static_cast<float>(jungle),
+        static_cast<float>(underworld)};
 }
 
 void identifySurfaceBiomes(World &world)
@@ -165,6 +171,7 @@ void genWorldBasePatches(Random &rnd, World &world)
             world.getBiome(x, y) = computeBiomeData(x, y, rnd);
         }
     });
+    world.invalidateBiomeSums(0, 0, world.getWidth(), world.getHeight());
     applyBaseTerrain(rnd, world);
     identifySurfaceBiomes(world);
 }
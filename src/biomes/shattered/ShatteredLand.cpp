@@ -121,7 +121,10 @@ void genShatteredLand(Random &rnd, World &world)
             numSmall -= 0.1;
         }
     }
-    parallelFor(std::views::iota(0, world.getWidth()), [&world](int x) {
+    // Each column lags one behind, finishing column x - 1 once column x is
+    // cleared, and surfaces extend from the previous column, so columns run in
+    // order to keep the result independent of thread count.
+    for (int x = 0; x < world.getWidth(); ++x) {
         bool foundSurface = false;
         for (int y = 0.5 * world.getUndergroundLevel(); y < world.getHeight();
              ++y) {
@@ -165,5 +168,5 @@ void genShatteredLand(Random &rnd, World &world)
                 }
             }
         }
-    });
+    }
 }
@@ -3,6 +3,8 @@
 
 namespace TileID
 {
+// TileTraits.h sizes its tables from the highest ID, hugeDragonEgg; update it
+// there when adding a higher ID.
 enum {
     empty = -1,
     dirt = 0,
@@ -0,0 +1,473 @@
+#include "ids/TileTraits.h"
+
+#include "ids/WallID.h"
+#include <cstddef>
+#include <utility>
+
+namespace
+{
+constexpr int nonSolidTiles[]{
+    TileID::empty,
+    TileID::alchemyTable,
+    TileID::altar,
+    TileID::amberTree,
+    TileID::amethystTree,
+    TileID::ashPlant,
+    TileID::ashTree,
+    TileID::ashVines,
+    TileID::banner,
+    TileID::bastStatue,
+    TileID::bathtub,
+    TileID::bed,
+    TileID::bench,
+    TileID::bewitchingTable,
+    TileID::boneWelder,
+    TileID::book,
+    TileID::bookcase,
+    TileID::borealBeam,
+    TileID::bottle,
+    TileID::boulder,
+    TileID::bouncyBoulder,
+    TileID::bubble,
+    TileID::cactusPlant,
+    TileID::campfire,
+    TileID::candelabra,
+    TileID::candle,
+    TileID::catacomb,
+    TileID::chain,
+    TileID::chair,
+    TileID::chandelier,
+    TileID::chest,
+    TileID::chestGroup2,
+    TileID::chimney,
+    TileID::clock,
+    TileID::cobweb,
+    TileID::coral,
+    TileID::corruptPlant,
+    TileID::corruptVines,
+    TileID::crimsonPlant,
+    TileID::crimsonVines,
+    TileID::detonator,
+    TileID::diamondTree,
+    TileID::door,
+    TileID::dresser,
+    TileID::emeraldTree,
+    TileID::explosives,
+    TileID::fallenLog,
+    TileID::fireplace,
+    TileID::flowerVines,
+    TileID::friendlyBoulder,
+    TileID::gem,
+    TileID::geyser,
+    TileID::ghoulder,
+    TileID::goldCoin,
+    TileID::graniteColumn,
+    TileID::grassPlant,
+    TileID::hellforge,
+    TileID::herb,
+    TileID::honeyDrip,
+    TileID::hugeDragonEgg,
+    TileID::junctionBox,
+    TileID::junglePlant,
+    TileID::jungleVines,
+    TileID::lamp,
+    TileID::lantern,
+    TileID::largeJunglePlant,
+    TileID::largePile,
+    TileID::largePileGroup2,
+    TileID::larva,
+    TileID::lavaBoulder,
+    TileID::lavaDrip,
+    TileID::lifeCrystal,
+    TileID::lifeCrystalBoulder,
+    TileID::lihzahrdAltar,
+    TileID::livingLoom,
+    TileID::loom,
+    TileID::manaCrystal,
+    TileID::marbleColumn,
+    TileID::minecartTrack,
+    TileID::mossPlant,
+    TileID::mushroomPlant,
+    TileID::mushroomVines,
+    TileID::orbHeart,
+    TileID::painting2x3,
+    TileID::painting3x2,
+    TileID::painting3x3,
+    TileID::painting6x4,
+    TileID::palmTree,
+    TileID::piano,
+    TileID::platform,
+    TileID::pot,
+    TileID::pressurePlate,
+    TileID::rainbowBoulder,
+    TileID::richMahoganyBeam,
+    TileID::rollingCactus,
+    TileID::rope,
+    TileID::rubyTree,
+    TileID::sakuraTree,
+    TileID::sandDrip,
+    TileID::sandstoneColumn,
+    TileID::sapphireTree,
+    TileID::sensor,
+    TileID::sharpeningStation,
+    TileID::shimmerDrip,
+    TileID::silverCoin,
+    TileID::sink,
+    TileID::skyMill,
+    TileID::sleepingDigtoise,
+    TileID::smallPile,
+    TileID::spiderBoulder,
+    TileID::stalactite,
+    TileID::statue,
+    TileID::sunflower,
+    TileID::table,
+    TileID::tableGroup2,
+    TileID::tallGrassPlant,
+    TileID::tallJunglePlant,
+    TileID::teleporter,
+    TileID::TNTBarrel,
+    TileID::toilet,
+    TileID::tombstone,
+    TileID::topazTree,
+    TileID::torch,
+    TileID::tree,
+    TileID::vineRope,
+    TileID::vines,
+    TileID::waterCandle,
+    TileID::waterDrip,
+    TileID::weatherVane,
+    TileID::woodenBeam,
+    TileID::workBench,
+    TileID::yellowWillowTree,
+};
+
+constexpr int slopedTiles[]{
+    TileID::dirt,
+    TileID::stone,
+    TileID::grass,
+    TileID::corruptGrass,
+    TileID::ebonstone,
+    TileID::meteorite,
+    TileID::clay,
+    TileID::sand,
+    TileID::obsidian,
+    TileID::ash,
+    TileID::mud,
+    TileID::jungleGrass,
+    TileID::mushroomGrass,
+    TileID::hallowedGrass,
+    TileID::ebonsand,
+    TileID::pearlsand,
+    TileID::pearlstone,
+    TileID::silt,
+    TileID::candyCane,
+    TileID::greenCandyCane,
+    TileID::snow,
+    TileID::ice,
+    TileID::corruptIce,
+    TileID::hallowedIce,
+    TileID::pineTree,
+    TileID::cloud,
+    TileID::livingWood,
+    TileID::leaf,
+    TileID::slime,
+    TileID::flesh,
+    TileID::rainCloud,
+    TileID::crimsonGrass,
+    TileID::crimsonIce,
+    TileID::crimstone,
+    TileID::slush,
+    TileID::hive,
+    TileID::honey,
+    TileID::crispyHoney,
+    TileID::crimsand,
+    TileID::coralstone,
+    TileID::smoothMarble,
+    TileID::marble,
+    TileID::granite,
+    TileID::smoothGranite,
+    TileID::pinkSlime,
+    TileID::lavaMossStone,
+    TileID::livingMahogany,
+    TileID::mahoganyLeaf,
+    TileID::crystalBlock,
+    TileID::sandstone,
+    TileID::hardenedSand,
+    TileID::hardenedEbonsand,
+    TileID::hardenedCrimsand,
+    TileID::ebonsandstone,
+    TileID::crimsandstone,
+    TileID::hardenedPearlsand,
+    TileID::pearlsandstone,
+    TileID::snowCloud,
+    TileID::lesion,
+    TileID::kryptonMossStone,
+    TileID::xenonMossStone,
+    TileID::argonMossStone,
+    TileID::neonMossStone,
+    TileID::heliumMossStone,
+    TileID::ashGrass,
+    TileID::corruptJungleGrass,
+    TileID::crimsonJungleGrass,
+    TileID::aetherium,
+};
+
+constexpr std::pair<int, int> stabilizeBlocks[]{
+    {TileID::sand, TileID::hardenedSand},
+    {TileID::ebonsand, TileID::hardenedEbonsand},
+    {TileID::pearlsand, TileID::hardenedPearlsand},
+    {TileID::silt, TileID::mud},
+    {TileID::slush, TileID::snow},
+    {TileID::crimsand, TileID::hardenedCrimsand},
+    {TileID::shellPile, TileID::hardenedSand},
+};
+
+constexpr int surfaceDryBlocks[]{
+    TileID::ebonstone,
+    TileID::ebonsand,
+    TileID::lesion,
+    TileID::corruptGrass,
+    TileID::corruptJungleGrass,
+    TileID::crimstone,
+    TileID::crimsand,
+    TileID::flesh,
+    TileID::crimsonGrass,
+    TileID::crimsonJungleGrass,
+    TileID::pearlstone,
+    TileID::pearlsand,
+    TileID::aetherium,
+    TileID::crystalBlock,
+    TileID::livingWood,
+    TileID::leaf,
+    TileID::livingMahogany,
+    TileID::mahoganyLeaf,
+    TileID::ashGrass,
+    TileID::sandstoneBrick,
+    TileID::ebonstoneBrick,
+    TileID::crimstoneBrick,
+    TileID::pearlstoneBrick,
+    TileID::blueBrick,
+    TileID::greenBrick,
+    TileID::pinkBrick,
+};
+
+constexpr std::pair<int, int> vineTypes[]{
+    {TileID::grass, TileID::vines},
+    {TileID::leaf, TileID::vines},
+    {TileID::jungleGrass, TileID::jungleVines},
+    {TileID::mahoganyLeaf, TileID::jungleVines},
+    {TileID::lihzahrdBrick, TileID::jungleVines},
+    {TileID::livingMahogany, TileID::vineRope},
+    {TileID::corruptGrass, TileID::corruptVines},
+    {TileID::corruptJungleGrass, TileID::corruptVines},
+    {TileID::crimsonGrass, TileID::crimsonVines},
+    {TileID::crimsonJungleGrass, TileID::crimsonVines},
+    {TileID::hallowedGrass, TileID::hallowedVines},
+    {TileID::mushroomGrass, TileID::mushroomVines},
+    {TileID::ashGrass, TileID::ashVines},
+};
+
+constexpr std::pair<int, int> dropperTypes[]{
+    {TileID::dirt, TileID::waterDrip},
+    {TileID::stone, TileID::waterDrip},
+    {TileID::jungleGrass, TileID::waterDrip},
+    {TileID::cloud, TileID::waterDrip},
+    {TileID::rainCloud, TileID::waterDrip},
+    {TileID::granite, TileID::waterDrip},
+    {TileID::marble, TileID::waterDrip},
+    {TileID::livingMahogany, TileID::waterDrip},
+    {TileID::mahoganyLeaf, TileID::waterDrip},
+    {TileID::lihzahrdBrick, TileID::waterDrip},
+    {TileID::ash, TileID::lavaDrip},
+    {TileID::ashGrass, TileID::lavaDrip},
+    {TileID::obsidianBrick, TileID::lavaDrip},
+    {TileID::hellstoneBrick, TileID::lavaDrip},
+    {TileID::sand, TileID::sandDrip},
+    {TileID::hardenedSand, TileID::sandDrip},
+    {TileID::sandstone, TileID::sandDrip},
+    {TileID::ebonsand, TileID::sandDrip},
+    {TileID::hardenedEbonsand, TileID::sandDrip},
+    {TileID::ebonsandstone, TileID::sandDrip},
+    {TileID::crimsand, TileID::sandDrip},
+    {TileID::hardenedCrimsand, TileID::sandDrip},
+    {TileID::crimsandstone, TileID::sandDrip},
+    {TileID::pearlsand, TileID::sandDrip},
+    {TileID::hardenedPearlsand, TileID::sandDrip},
+    {TileID::pearlsandstone, TileID::sandDrip},
+    {TileID::aetherium, TileID::shimmerDrip},
+    {TileID::hive, TileID::honeyDrip},
+};
+
+constexpr int glacierWhiteBlocks[]{
+    TileID::ash,
+    TileID::ashGrass,
+    TileID::clay,
+    TileID::corruptGrass,
+    TileID::corruptJungleGrass,
+    TileID::crimsand,
+    TileID::crimsandstone,
+    TileID::crimsonGrass,
+    TileID::crimsonJungleGrass,
+    TileID::crimstone,
+    TileID::dirt,
+    TileID::ebonsand,
+    TileID::ebonsandstone,
+    TileID::ebonstone,
+    TileID::grass,
+    TileID::hallowedGrass,
+    TileID::hardenedCrimsand,
+    TileID::hardenedEbonsand,
+    TileID::hardenedSand,
+    TileID::jungleGrass,
+    TileID::mud,
+    TileID::mushroomGrass,
+    TileID::sand,
+    TileID::sandstone,
+    TileID::slime,
+    TileID::stone,
+};
+
+constexpr int glacierCyanBlocks[]{
+    TileID::tinOre,
+    TileID::leadOre,
+    TileID::tungstenOre,
+    TileID::platinumOre,
+    TileID::palladiumOre,
+    TileID::orichalcumOre,
+    TileID::titaniumOre,
+};
+
+constexpr int glacierSkyBlueBlocks[]{
+    TileID::copperOre,
+    TileID::ironOre,
+    TileID::silverOre,
+    TileID::goldOre,
+    TileID::cobaltOre,
+    TileID::mythrilOre,
+    TileID::adamantiteOre,
+    TileID::hellstone,
+    TileID::hellstoneBrick,
+    TileID::obsidianBrick,
+};
+
+constexpr int lavaExemptWalls[]{
+    WallID::empty,
+    WallID::Unsafe::blueBrick,
+    WallID::Unsafe::blueSlab,
+    WallID::Unsafe::blueTiled,
+    WallID::Unsafe::greenBrick,
+    WallID::Unsafe::greenSlab,
+    WallID::Unsafe::greenTiled,
+    WallID::Unsafe::pinkBrick,
+    WallID::Unsafe::pinkSlab,
+    WallID::Unsafe::pinkTiled,
+    WallID::Unsafe::lihzahrdBrick,
+};
+
+constexpr int glacierWhiteWalls[]{
+    WallID::Safe::hardenedSand,
+    WallID::Safe::sandstone,
+    WallID::Safe::smoothSandstone,
+    WallID::Unsafe::hardenedSand,
+    WallID::Unsafe::sandstone,
+};
+
+constexpr int glacierSkyBlueWalls[]{
+    WallID::Safe::ember,
+    WallID::Safe::obsidianBrick,
+    WallID::Unsafe::hellstoneBrick,
+    WallID::Unsafe::obsidianBrick,
+    WallID::Unsafe::ember,
+    WallID::Unsafe::cinder,
+    WallID::Unsafe::magma,
+    WallID::Unsafe::smoulderingStone,
+};
+
+template <size_t N>
+constexpr bool idsInRange(const int (&ids)[N], int minID, int maxID)
+{
+    for (int id : ids) {
+        if (id < minID || id >= maxID) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <size_t N>
+constexpr bool
+idsInRange(const std::pair<int, int> (&ids)[N], int minID, int maxID)
+{
+    for (auto [a, b] : ids) {
+        if (a < minID || a >= maxID || b < minID || b >= maxID) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Table sizes are fixed in TileTraits.h; every ID listed must fit.
+constexpr int maxBlockID = detail::numBlockTraits - 1;
+static_assert(idsInRange(nonSolidTiles, TileID::empty, maxBlockID));
+static_assert(idsInRange(slopedTiles, TileID::empty, maxBlockID));
+static_assert(idsInRange(stabilizeBlocks, TileID::empty, maxBlockID));
+static_assert(idsInRange(surfaceDryBlocks, TileID::empty, maxBlockID));
+static_assert(idsInRange(vineTypes, TileID::empty, maxBlockID));
+static_assert(idsInRange(dropperTypes, TileID::empty, maxBlockID));
+static_assert(idsInRange(glacierWhiteBlocks, TileID::empty, maxBlockID));
+static_assert(idsInRange(glacierCyanBlocks, TileID::empty, maxBlockID));
+static_assert(idsInRange(glacierSkyBlueBlocks, TileID::empty, maxBlockID));
+static_assert(idsInRange(lavaExemptWalls, 0, detail::numWallTraits));
+static_assert(idsInRange(glacierWhiteWalls, 0, detail::numWallTraits));
+static_assert(idsInRange(glacierSkyBlueWalls, 0, detail::numWallTraits));
+
+constexpr std::array<BlockTraits, detail::numBlockTraits> genBlockTraits()
+{
+    std::array<BlockTraits, detail::numBlockTraits> table;
+    table.fill({0, TileID::empty, TileID::empty, TileID::empty});
+    auto setFlag = [&table](const auto &blockIDs, uint16_t trait) {
+        for (int blockID : blockIDs) {
+            table[blockID + 1].flags |= trait;
+        }
+    };
+    setFlag(nonSolidTiles, BlockTrait::nonSolid);
+    setFlag(slopedTiles, BlockTrait::sloped);
+    setFlag(surfaceDryBlocks, BlockTrait::surfaceDry);
+    setFlag(glacierWhiteBlocks, BlockTrait::glacierWhite);
+    setFlag(glacierCyanBlocks, BlockTrait::glacierCyan);
+    setFlag(glacierSkyBlueBlocks, BlockTrait::glacierSkyBlue);
+    for (auto [blockID, stabilized] : stabilizeBlocks) {
+        table[blockID + 1].stabilized = stabilized;
+    }
+    for (auto [blockID, vine] : vineTypes) {
+        table[blockID + 1].vine = vine;
+    }
+    for (auto [blockID, dropper] : dropperTypes) {
+        table[blockID + 1].dropper = dropper;
+    }
+    return table;
+}
+
+constexpr std::array<WallTraits, detail::numWallTraits> genWallTraits()
+{
+    std::array<WallTraits, detail::numWallTraits> table;
+    table.fill({0});
+    auto setFlag = [&table](const auto &wallIDs, uint8_t trait) {
+        for (int wallID : wallIDs) {
+            table[wallID].flags |= trait;
+        }
+    };
+    setFlag(lavaExemptWalls, WallTrait::lavaExempt);
+    setFlag(glacierWhiteWalls, WallTrait::glacierWhite);
+    setFlag(glacierSkyBlueWalls, WallTrait::glacierSkyBlue);
+    return table;
+}
+} // namespace
+
+namespace detail
+{
+constexpr std::array<BlockTraits, numBlockTraits> blockTraitTable =
+    genBlockTraits();
+constexpr std::array<WallTraits, numWallTraits> wallTraitTable =
+    genWallTraits();
+} // namespace detail
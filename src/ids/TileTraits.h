@@ -0,0 +1,119 @@
+#ifndef TILETRAITS_H
+#define TILETRAITS_H
+
+#include "ids/TileID.h"
+#include "ids/WallID.h"
+#include <array>
+#include <cassert>
+#include <cstdint>
+
+/**
+ * Per block type flags, as bits of BlockTraits::flags.
+ */
+namespace BlockTrait
+{
+enum : uint16_t {
+    /**
+     * Does not count as solid ground (see isSolidBlock()).
+     */
+    nonSolid = 1 << 0,
+    /**
+     * Slopes to match exposed surroundings during surface smoothing.
+     */
+    sloped = 1 << 1,
+    /**
+     * Surface rain does not pool on this block.
+     */
+    surfaceDry = 1 << 2,
+    // Paint applied by glaciation.
+    glacierWhite = 1 << 3,
+    glacierCyan = 1 << 4,
+    glacierSkyBlue = 1 << 5,
+};
+}
+
+/**
+ * Per wall type flags, as bits of WallTraits::flags.
+ */
+namespace WallTrait
+{
+enum : uint8_t {
+    /**
+     * Lava hotzones do not fill open tiles in front of this wall.
+     */
+    lavaExempt = 1 << 0,
+    // Paint applied by glaciation.
+    glacierWhite = 1 << 1,
+    glacierSkyBlue = 1 << 2,
+};
+}
+
+struct BlockTraits {
+    uint16_t flags;
+    /**
+     * Non-falling replacement for unsupported sand-like blocks, or
+     * TileID::empty.
+     */
+    int16_t stabilized;
+    /**
+     * Vine grown below this block, or TileID::empty.
+     */
+    int16_t vine;
+    /**
+     * Ambient drip placed below this block, or TileID::empty.
+     */
+    int16_t dropper;
+
+    bool is(uint16_t trait) const
+    {
+        return flags & trait;
+    }
+};
+
+struct WallTraits {
+    uint8_t flags;
+
+    bool is(uint8_t trait) const
+    {
+        return flags & trait;
+    }
+};
+
+namespace detail
+{
+// Covers TileID::empty (-1) through hugeDragonEgg, the highest tile ID.
+// TileTraits.cpp checks that every ID it lists fits.
+constexpr int numBlockTraits = TileID::hugeDragonEgg + 2;
+// Covers every vanilla wall ID, as structure data may place walls without a
+// named constant.
+constexpr int numWallTraits = 366;
+static_assert(WallID::Safe::forbidden < numWallTraits);
+static_assert(WallID::Unsafe::livingWood < numWallTraits);
+
+extern const std::array<BlockTraits, numBlockTraits> blockTraitTable;
+extern const std::array<WallTraits, numWallTraits> wallTraitTable;
+} // namespace detail
+
+/**
+ * Static properties of a block type, as a single table load.
+ */
+inline const BlockTraits &blockTraits(int blockID)
+{
+#ifdef DEBUG_BOUNDS
+    assert(blockID >= -1 && blockID + 1 < detail::numBlockTraits);
+#endif
+    return detail::blockTraitTable[blockID + 1];
+}
+
+/**
+ * Static properties of a wall type, as a single table load.
+ */
+inline const WallTraits &wallTraits(int wallID)
+{
+#ifdef DEBUG_BOUNDS
+    assert(wallID >= 0 && wallID < detail::numWallTraits);
+#endif
+    return detail::wallTraitTable[wallID];
+}
+
+#endif // TILETRAITS_H
@@ -9,6 +9,8 @@ enum { empty = 0 };
 
 namespace Safe
 {
+// TileTraits.h checks the highest ID, forbidden, fits its tables; update it
+// there when adding a higher ID.
 enum {
     stone = 1,
     wood = 4,
@@ -118,6 +120,8 @@ enum {
 
 namespace Unsafe
 {
+// TileTraits.h checks the highest ID, livingWood, fits its tables; update
+// it there when adding a higher ID.
 enum {
     dirt = 2,
     ebonstone = 3,
@@ -9,8 +9,9 @@ void savePreviewImage(std::string basename, World &world)
 {
     std::vector<uint8_t> img(3 * world.getWidth() * world.getHeight());
     parallelFor(std::views::iota(0, world.getWidth()), [&img, &world](int x) {
+        std::span<Tile> column = world.column(x);
         for (int y = 0; y < world.getHeight(); ++y) {
-            Color color = getTileColor(x, y, world);
+            Color color = getTileColor(column[y], y, world);
             std::copy(
                 color.rgb,
                 color.rgb + 3,
@@ -384,10 +384,9 @@ Color getLayerColor(int y, World &world)
     }
 }
 
-Color getTileColor(int x, int y, World &world)
+Color getTileColor(const Tile &tile, int y, World &world)
 {
     Color color = getLayerColor(y, world);
-    Tile &tile = world.getTile(x, y);
     if (tile.wallID != WallID::empty) {
         Color wallColor{wallColors + 3 * tile.wallID};
         if (tile.wallPaint != Paint::none) {
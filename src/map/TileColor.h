@@ -3,6 +3,7 @@
 
 #include <cstdint>
 
+class Tile;
 class World;
 
 class Color
@@ -15,6 +16,9 @@ public:
     uint8_t rgb[3];
 };
 
-Color getTileColor(int x, int y, World &world);
+/**
+ * Map color of a tile, located at height y.
+ */
+Color getTileColor(const Tile &tile, int y, World &world);
 
 #endif // TILECOLOR_H
@@ -278,21 +278,22 @@ private:
         }
         world.queuedDeco.addTask(
             [x, y, mapWidth, mapHeight, scale](Random &rnd, World &world) {
-                parallelFor(
-                    std::views::iota(0, mapWidth),
-                    [x, y, mapHeight, scale, &world](int i) {
-                        for (int j = 0; j < mapHeight; ++j) {
-                            Tile &tile = world.getTile(x + i, y + j);
-                            tile.blockID = getSectorColor(i, j, scale, world);
-                            tile.blockPaint = Paint::none;
-                            if (tile.blockID == TileID::torch) {
-                                tile.frameX = 66;
-                                tile.frameY = 286;
-                            } else {
-                                tile.actuated = true;
-                            }
+                // Sectors sample the whole world, including the map itself,
+                // so columns run in order to keep the result independent of
+                // thread count.
+                for (int i = 0; i < mapWidth; ++i) {
+                    for (int j = 0; j < mapHeight; ++j) {
+                        Tile &tile = world.getTile(x + i, y + j);
+                        tile.blockID = getSectorColor(i, j, scale, world);
+                        tile.blockPaint = Paint::none;
+                        if (tile.blockID == TileID::torch) {
+                            tile.frameX = 66;
+                            tile.frameY = 286;
+                        } else {
+                            tile.actuated = true;
                         }
-                    });
+                    }
+                }
                 if (world.conf.forTheWorthy) {
                     std::vector<Tile> mapTiles;
                     for (int j = 0; j < mapHeight; ++j) {
@@ -627,7 +628,7 @@ private:
     {
         int numSpikes =
             dungeonWidth * world.getHeight() / rnd.getInt(10080, 15120);
-        std::vector<Point> usedLocations;
+        LocationIndex usedLocations;
         for (int iter = 0; iter < numSpikes; ++iter) {
             auto [x, y] = selectPaintingLocation(
                 dungeonCenter,
@@ -639,7 +640,7 @@ private:
             if (x == -1) {
                 continue;
             }
-            usedLocations.emplace_back(x, y);
+            usedLocations.insert({x, y});
             x += 3;
             y -= 5;
             bool asCross = rnd.getBool();
@@ -820,7 +821,7 @@ private:
         int width,
         int height,
         int radius,
-        const std::vector<Point> &usedLocations)
+        const LocationIndex &usedLocations)
     {
         for (int tries = 0; tries < 500; ++tries) {
             int x = rnd.getInt(
@@ -871,7 +872,7 @@ private:
             dungeonPaintings.begin(),
             dungeonPaintings.end(),
             rnd.getPRNG());
-        std::vector<Point> usedLocations;
+        LocationIndex usedLocations;
         for (int i = 0; i < numPaintings; ++i) {
             Painting curPainting = rnd.pool(dungeonPaintings);
             auto [width, height] = world.getPaintingDims(curPainting);
@@ -883,7 +884,7 @@ private:
                 40,
                 usedLocations);
             if (x != -1) {
-                usedLocations.emplace_back(x, y);
+                usedLocations.insert({x, y});
                 world.placePainting(x + 2, y - height - 1, curPainting);
             }
         }
@@ -912,7 +913,7 @@ private:
                 25,
                 usedLocations);
             if (x != -1) {
-                usedLocations.emplace_back(x, y);
+                usedLocations.insert({x, y});
                 world.placePainting(x + 2, y - height - 1, curPainting);
             }
         }
@@ -953,7 +954,7 @@ private:
         int dungeonCenter,
         int dungeonWidth,
         TileBuffer &data,
-        const std::vector<Point> &usedLocations)
+        const LocationIndex &usedLocations)
     {
         bool anchorTop =
             data.getWidth() > 1 && data.getTile(1, 0).blockID == TileID::cloud;
@@ -1020,7 +1021,7 @@ private:
     {
         double numPlacements =
             dungeonWidth * world.getHeight() / rnd.getInt(4536, 6048);
-        std::vector<Point> usedLocations;
+        LocationIndex usedLocations;
         while (numPlacements > 0) {
             TileBuffer data = getFurniture(
                 rnd.select(Data::furnitureLayouts),
@@ -1035,7 +1036,7 @@ private:
                 numPlacements -= 0.1;
                 continue;
             }
-            usedLocations.emplace_back(x, y);
+            usedLocations.insert({x, y});
             for (auto [chestX, chestY] :
                  world.placeBuffer(x, y, data, Blend::blockOnly)) {
                 fillDresser(world.registerStorage(chestX, chestY), rnd);
@@ -22,29 +22,30 @@ void genGlobalEcho(Random &rnd, World &world)
     } else if (fadedMemories > 0.95) {
         threshold = std::lerp(threshold, 1.12, 20 * fadedMemories - 19);
     }
-    parallelFor(
-        std::views::iota(0, world.getWidth()),
-        [threshold, &rnd, &world](int x) {
-            for (int y = 0; y < world.getHeight(); ++y) {
-                if (rnd.getCoarseNoise(x, y) > threshold) {
-                    continue;
-                }
-                Tile &tile = world.getTile(x, y);
-                if (tile.blockID != TileID::empty) {
-                    tile.echoCoatBlock = true;
-                    for (int i = -1; i < 2; ++i) {
-                        for (int j = -1; j < 2; ++j) {
-                            Tile &wallTile = world.getTile(x + i, y + j);
-                            if (wallTile.wallID != WallID::empty) {
-                                wallTile.echoCoatWall = true;
-                            }
+    // Coating spreads to neighboring walls, whose flags share storage with
+    // tiles other columns update, so columns run in order to keep the result
+    // independent of thread count.
+    for (int x = 0; x < world.getWidth(); ++x) {
+        for (int y = 0; y < world.getHeight(); ++y) {
+            if (rnd.getCoarseNoise(x, y) > threshold) {
+                continue;
+            }
+            Tile &tile = world.getTile(x, y);
+            if (tile.blockID != TileID::empty) {
+                tile.echoCoatBlock = true;
+                for (int i = -1; i < 2; ++i) {
+                    for (int j = -1; j < 2; ++j) {
+                        Tile &wallTile = world.getTile(x + i, y + j);
+                        if (wallTile.wallID != WallID::empty) {
+                            wallTile.echoCoatWall = true;
                         }
                     }
-                } else if (tile.wallID != WallID::empty) {
-                    tile.echoCoatWall = true;
                 }
+            } else if (tile.wallID != WallID::empty) {
+                tile.echoCoatWall = true;
             }
-        });
+        }
+    }
     for (int i = -25; i < 25; ++i) {
         for (int j = -25; j < 25; ++j) {
             double dist = std::hypot(i, j);
@@ -4,8 +4,8 @@
 #include "Random.h"
 #include "Util.h"
 #include "World.h"
+#include "ids/TileTraits.h"
 #include "ids/WallID.h"
-#include "vendor/frozen/set.h"
 #include <iostream>
 #include <set>
 
@@ -75,33 +75,6 @@ void simulateRain(Random &rnd, World &world, int x)
     double waterMult = computeRainMultiplier(world.conf.lakeSize);
     double lavaMult =
         computeRainMultiplier(std::midpoint(world.conf.lakeSize, 1.0));
-    constexpr auto surfaceDryBlocks = frozen::make_set<int>(
-        {TileID::ebonstone,
-         TileID::ebonsand,
-         TileID::lesion,
-         TileID::corruptGrass,
-         TileID::corruptJungleGrass,
-         TileID::crimstone,
-         TileID::crimsand,
-         TileID::flesh,
-         TileID::crimsonGrass,
-         TileID::crimsonJungleGrass,
-         TileID::pearlstone,
-         TileID::pearlsand,
-         TileID::aetherium,
-         TileID::crystalBlock,
-         TileID::livingWood,
-         TileID::leaf,
-         TileID::livingMahogany,
-         TileID::mahoganyLeaf,
-         TileID::ashGrass,
-         TileID::sandstoneBrick,
-         TileID::ebonstoneBrick,
-         TileID::crimstoneBrick,
-         TileID::pearlstoneBrick,
-         TileID::blueBrick,
-         TileID::greenBrick,
-         TileID::pinkBrick});
     std::set<int> dryWalls{
         WallID::Safe::sandstoneBrick,
         WallID::Unsafe::sandstone,
@@ -151,7 +124,7 @@ void simulateRain(Random &rnd, World &world, int x)
             if (probeTile.liquid == Liquid::shimmer ||
                 probeTile.blockID == TileID::bubble ||
                 (y < world.getUndergroundLevel() &&
-                 (surfaceDryBlocks.contains(probeTile.blockID) ||
+                 (blockTraits(probeTile.blockID).is(BlockTrait::surfaceDry) ||
                   probeTile.liquid == Liquid::lava)) ||
                 dropY > world.getUnderworldLevel() + 50 ||
                 (world.conf.shattered && dropY < lavaLevel &&
@@ -159,10 +132,10 @@ void simulateRain(Random &rnd, World &world, int x)
                 continue;
             }
             if (y < world.getUndergroundLevel() &&
-                (surfaceDryBlocks.contains(
-                     world.getTile(minDropX - 1, dropY).blockID) ||
-                 surfaceDryBlocks.contains(
-                     world.getTile(maxDropX, dropY).blockID))) {
+                (blockTraits(world.getTile(minDropX - 1, dropY).blockID)
+                     .is(BlockTrait::surfaceDry) ||
+                 blockTraits(world.getTile(maxDropX, dropY).blockID)
+                     .is(BlockTrait::surfaceDry))) {
                 continue;
             }
             for (int dropX = minDropX; dropX < maxDropX; ++dropX) {
@@ -224,25 +197,13 @@ void fillLavaHotzones(Random &rnd, World &world, int x)
 {
     int lavaLevel =
         (world.getCavernLevel() + 2 * world.getUnderworldLevel()) / 3;
-    constexpr auto skipWalls = frozen::make_set<int>({
-        WallID::empty,
-        WallID::Unsafe::blueBrick,
-        WallID::Unsafe::blueSlab,
-        WallID::Unsafe::blueTiled,
-        WallID::Unsafe::greenBrick,
-        WallID::Unsafe::greenSlab,
-        WallID::Unsafe::greenTiled,
-        WallID::Unsafe::pinkBrick,
-        WallID::Unsafe::pinkSlab,
-        WallID::Unsafe::pinkTiled,
-        WallID::Unsafe::lihzahrdBrick,
-    });
     for (int y = world.getSurfaceLevel(x) + 10; y < lavaLevel; ++y) {
         if (world.getBiome(x, y).underworld < 0.99) {
             continue;
         }
         Tile &tile = world.getTile(x, y);
-        if (tile.blockID == TileID::empty && !skipWalls.contains(tile.wallID) &&
+        if (tile.blockID == TileID::empty &&
+            !wallTraits(tile.wallID).is(WallTrait::lavaExempt) &&
             tile.liquid != Liquid::shimmer) {
             if (std::abs(rnd.getFineNoise(x, y)) < 0.06) {
                 tile.blockID = TileID::obsidian;
@@ -347,52 +308,51 @@ void convertUndergroundLava(World &world, int x)
 void genLake(Random &rnd, World &world)
 {
     std::cout << "Raining\n";
-    parallelFor(std::views::iota(0, world.getWidth()), [&rnd, &world](int x) {
+    // Rain flows and pools across any number of columns, and evaporation
+    // reads neighboring pools, so columns run in order to keep the result
+    // independent of thread count.
+    for (int x = 0; x < world.getWidth(); ++x) {
         simulateRain(rnd, world, x);
-    });
-    parallelFor(std::views::iota(0, world.getWidth()), [&world](int x) {
+    }
+    for (int x = 0; x < world.getWidth(); ++x) {
         evaporateSmallPools(world, x);
-    });
+    }
     if (world.conf.biomes != BiomeLayout::columns) {
         rnd.shuffleNoise();
         parallelFor(
             std::views::iota(0, world.getWidth()),
             [&rnd, &world](int x) { fillLavaHotzones(rnd, world, x); });
     }
+    // Liquid conversions below flood fill whole pools, which may span many
+    // columns, so they also run in order.
     if (world.conf.hiveQueen) {
         rnd.shuffleNoise();
-        parallelFor(
-            std::views::iota(0, world.getWidth()),
-            [&rnd, &world](int x) {
-                if (world.oceanCaveCenter < world.getWidth() / 2
-                        ? x > 350
-                        : x < world.getWidth() - 350) {
-                    for (int y = 0; y < world.getUnderworldLevel(); ++y) {
-                        if (world.getTile(x, y).liquid == Liquid::water &&
-                            rnd.getCoarseNoise(x, y) > 0.13) {
-                            convertLiquid(
-                                x,
-                                y,
-                                Liquid::water,
-                                Liquid::honey,
-                                world);
-                        }
-                    }
+        for (int x = 0; x < world.getWidth(); ++x) {
+            if (world.oceanCaveCenter < world.getWidth() / 2
+                    ? x <= 350
+                    : x >= world.getWidth() - 350) {
+                continue;
+            }
+            for (int y = 0; y < world.getUnderworldLevel(); ++y) {
+                if (world.getTile(x, y).liquid == Liquid::water &&
+                    rnd.getCoarseNoise(x, y) > 0.13) {
+                    convertLiquid(x, y, Liquid::water, Liquid::honey, world);
                 }
-            });
+            }
+        }
     }
     if (world.conf.forTheWorthy) {
         rnd.shuffleNoise();
-        parallelFor(
-            std::views::iota(0, world.getWidth()),
-            [&rnd, &world](int x) { convertExtraLava(rnd, world, x); });
+        for (int x = 0; x < world.getWidth(); ++x) {
+            convertExtraLava(rnd, world, x);
+        }
     }
     if (world.conf.celebration) {
         spreadShimmer(world);
     }
     if (world.conf.ascent) {
-        parallelFor(std::views::iota(0, world.getWidth()), [&world](int x) {
+        for (int x = 0; x < world.getWidth(); ++x) {
             convertUndergroundLava(world, x);
-        });
+        }
     }
 }
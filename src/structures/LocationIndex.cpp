@@ -0,0 +1,143 @@
+#include "structures/LocationIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+LocationIndex::LocationIndex(int cellSize)
+    : cellSize(cellSize), minCellX(0), minCellY(0), maxCellX(-1),
+      maxCellY(-1)
+{
+}
+
+LocationIndex::LocationIndex(std::initializer_list<Point> init)
+    : LocationIndex()
+{
+    for (Point pt : init) {
+        insert(pt);
+    }
+}
+
+int LocationIndex::toCell(int val) const
+{
+    // Round toward negative infinity, so cells are uniform across 0.
+    return val >= 0 ? val / cellSize : (val + 1) / cellSize - 1;
+}
+
+uint64_t LocationIndex::getCellKey(int cellX, int cellY) const
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) |
+           static_cast<uint32_t>(cellY);
+}
+
+template <typename Func>
+void LocationIndex::visitNear(int x, int y, int radius, Func visitor) const
+{
+    int fromX = std::max(toCell(x - radius), minCellX);
+    int toX = std::min(toCell(x + radius), maxCellX);
+    int fromY = std::max(toCell(y - radius), minCellY);
+    int toY = std::min(toCell(y + radius), maxCellY);
+    if (fromX > toX || fromY > toY) {
+        return;
+    }
+    if (static_cast<size_t>(toX - fromX + 1) * (toY - fromY + 1) >=
+        locations.size()) {
+        for (size_t i = 0; i < locations.size(); ++i) {
+            if (!visitor(i)) {
+                return;
+            }
+        }
+        return;
+    }
+    for (int cellX = fromX; cellX <= toX; ++cellX) {
+        for (int cellY = fromY; cellY <= toY; ++cellY) {
+            auto itr = cells.find(getCellKey(cellX, cellY));
+            if (itr == cells.end()) {
+                continue;
+            }
+            for (int i : itr->second) {
+                if (!visitor(i)) {
+                    return;
+                }
+            }
+        }
+    }
+}
+
+void LocationIndex::insert(Point pt)
+{
+    int cellX = toCell(pt.x);
+    int cellY = toCell(pt.y);
+    if (locations.empty()) {
+        minCellX = maxCellX = cellX;
+        minCellY = maxCellY = cellY;
+    } else {
+        minCellX = std::min(minCellX, cellX);
+        maxCellX = std::max(maxCellX, cellX);
+        minCellY = std::min(minCellY, cellY);
+        maxCellY = std::max(maxCellY, cellY);
+    }
+    cells[getCellKey(cellX, cellY)].push_back(locations.size());
+    locations.push_back(pt);
+}
+
+void LocationIndex::clear()
+{
+    locations.clear();
+    cells.clear();
+    minCellX = minCellY = 0;
+    maxCellX = maxCellY = -1;
+}
+
+int LocationIndex::countNear(int x, int y, int radius, int maxCount) const
+{
+    int count = 0;
+    visitNear(x, y, radius, [x, y, radius, maxCount, &count, this](int i) {
+        auto [usedX, usedY] = locations[i];
+        if (std::hypot(x - usedX, y - usedY) < radius) {
+            ++count;
+        }
+        return count < maxCount;
+    });
+    return count;
+}
+
+Point LocationIndex::findNearest(int x, int y) const
+{
+    int best = -1;
+    double bestDist = std::numeric_limits<double>::infinity();
+    auto testLocation = [x, y, &best, &bestDist, this](int i) {
+        auto [usedX, usedY] = locations[i];
+        double dist = std::hypot(x - usedX, y - usedY);
+        if (dist < bestDist || (dist == bestDist && i < best)) {
+            best = i;
+            bestDist = dist;
+        }
+    };
+    int cellX = toCell(x);
+    int cellY = toCell(y);
+    int maxRing = std::max(
+        {std::abs(cellX - minCellX),
+         std::abs(cellX - maxCellX),
+         std::abs(cellY - minCellY),
+         std::abs(cellY - maxCellY)});
+    // Search outward in square rings of cells, until the ring is farther than
+    // the best found.
+    for (int ring = 0; ring <= maxRing && !locations.empty(); ++ring) {
+        if (ring > 0 && (ring - 1) * cellSize + 1 > bestDist) {
+            break;
+        }
+        for (int i = -ring; i <= ring; ++i) {
+            int step = std::abs(i) == ring ? 1 : std::max(2 * ring, 1);
+            for (int j = -ring; j <= ring; j += step) {
+                auto itr = cells.find(getCellKey(cellX + i, cellY + j));
+                if (itr != cells.end()) {
+                    for (int idx : itr->second) {
+                        testLocation(idx);
+                    }
+                }
+            }
+        }
+    }
+    return best == -1 ? Point{-1, -1} : locations[best];
+}
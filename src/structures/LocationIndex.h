@@ -0,0 +1,71 @@
+#ifndef LOCATIONINDEX_H
+#define LOCATIONINDEX_H
+
+#include "Point.h"
+#include <cstdint>
+#include <initializer_list>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Set of locations bucketed into a grid of square cells, for fast proximity
+ * queries.
+ */
+class LocationIndex
+{
+private:
+    int cellSize;
+    std::vector<Point> locations;
+    std::unordered_map<uint64_t, std::vector<int>> cells;
+    int minCellX;
+    int minCellY;
+    int maxCellX;
+    int maxCellY;
+
+    int toCell(int val) const;
+    uint64_t getCellKey(int cellX, int cellY) const;
+
+    /**
+     * Call visitor with the index of every location in cells overlapping the
+     * square of the specified radius, or with every location if that is
+     * cheaper. Stops early if visitor returns false.
+     */
+    template <typename Func>
+    void visitNear(int x, int y, int radius, Func visitor) const;
+
+public:
+    LocationIndex(int cellSize = 32);
+    LocationIndex(std::initializer_list<Point> init);
+
+    void insert(Point pt);
+    void clear();
+
+    size_t size() const
+    {
+        return locations.size();
+    }
+
+    std::vector<Point>::const_iterator begin() const
+    {
+        return locations.begin();
+    }
+
+    std::vector<Point>::const_iterator end() const
+    {
+        return locations.end();
+    }
+
+    /**
+     * Number of locations strictly within the radius of (x, y). Counting
+     * stops once maxCount is reached.
+     */
+    int countNear(int x, int y, int radius, int maxCount) const;
+
+    /**
+     * Closest location to (x, y), with ties going to the earliest inserted.
+     * Returns {-1, -1} if empty.
+     */
+    Point findNearest(int x, int y) const;
+};
+
+#endif // LOCATIONINDEX_H
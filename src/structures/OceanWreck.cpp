@@ -10,7 +10,7 @@
 #include <algorithm>
 #include <iostream>
 
-bool tryPlaceWreck(int x, int y, TileBuffer &wreck, World &world)
+bool tryPlaceWreck(int x, int y, const TileBuffer &wreck, World &world)
 {
     int surfaceLeft = y;
     int rightX = x + wreck.getWidth() - 1;
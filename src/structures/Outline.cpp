@@ -49,36 +49,37 @@ void genGlobalOutline(World &world)
 {
     std::cout << "Exposing details\n";
     bool illuminate = world.conf.fadedMemories < 0.001;
-    parallelFor(
-        std::views::iota(0, world.getWidth()),
-        [illuminate, &world](int x) {
-            for (int y = 0; y < world.getHeight(); ++y) {
-                Tile &tile = world.getTile(x, y);
-                if (world.conf.celebration &&
-                    world.regionPasses(x - 1, y - 1, 3, 3, [](Tile &tile) {
-                        return !tile.echoCoatBlock &&
-                               oreBacklights.contains(tile.blockID);
-                    })) {
-                    tile.wallID = oreBacklights.at(tile.blockID);
-                    tile.wallPaint = Paint::none;
-                    continue;
-                }
-                if (!isSolidBlock(tile.blockID) || tile.actuated ||
-                    (!illuminate && !tile.echoCoatBlock)) {
-                    continue;
-                }
-                if (world.regionPasses(x - 1, y - 1, 3, 3, [](Tile &tile) {
-                        return isSolidBlock(tile.blockID) ||
-                               embeddedTraps.contains(tile.blockID);
-                    })) {
-                    continue;
-                }
-                if (illuminate) {
-                    tile.illuminantBlock = true;
-                } else {
-                    tile.echoCoatBlock = false;
-                    tile.blockPaint = Paint::negative;
-                }
+    // Ore backlights check coating that neighboring columns may have removed,
+    // so columns run in order to keep the result independent of thread count.
+    for (int x = 0; x < world.getWidth(); ++x) {
+        std::span<Tile> column = world.column(x);
+        for (int y = 0; y < world.getHeight(); ++y) {
+            Tile &tile = column[y];
+            if (world.conf.celebration &&
+                world.regionPasses(x - 1, y - 1, 3, 3, [](Tile &tile) {
+                    return !tile.echoCoatBlock &&
+                           oreBacklights.contains(tile.blockID);
+                })) {
+                tile.wallID = oreBacklights.at(tile.blockID);
+                tile.wallPaint = Paint::none;
+                continue;
             }
-        });
+            if (!isSolidBlock(tile.blockID) || tile.actuated ||
+                (!illuminate && !tile.echoCoatBlock)) {
+                continue;
+            }
+            if (world.regionPasses(x - 1, y - 1, 3, 3, [](Tile &tile) {
+                    return isSolidBlock(tile.blockID) ||
+                           embeddedTraps.contains(tile.blockID);
+                })) {
+                continue;
+            }
+            if (illuminate) {
+                tile.illuminantBlock = true;
+            } else {
+                tile.echoCoatBlock = false;
+                tile.blockPaint = Paint::negative;
+            }
+        }
+    }
 }
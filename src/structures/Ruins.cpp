@@ -14,7 +14,7 @@
 #include <iostream>
 #include <set>
 
-bool canPlaceFurniture(int x, int y, TileBuffer &data, World &world)
+bool canPlaceFurniture(int x, int y, const TileBuffer &data, World &world)
 {
     for (int i = 0; i < data.getWidth(); ++i) {
         for (int j = 0; j < data.getHeight(); ++j) {
@@ -328,7 +328,7 @@ void genRuins(Random &rnd, World &world)
         TileID::obsidianBrick,
         WallID::Safe::redStainedGlass,
         world.getFramedTiles());
-    std::vector<Point> usedLocations;
+    LocationIndex usedLocations;
     for (; locItr != locations.end(); ++locItr) {
         auto [x, y] = *locItr;
         y = scanWhileEmpty({x, y}, {0, -1}, world).y;
@@ -344,7 +344,7 @@ void genRuins(Random &rnd, World &world)
             isLocationUsed(x, y, 10, usedLocations)) {
             continue;
         }
-        usedLocations.emplace_back(x, y);
+        usedLocations.insert({x, y});
         for (int i = 0; i < data.getWidth(); ++i) {
             for (int j = 0; j < data.getHeight(); ++j) {
                 Tile &dataTile = data.getTile(i, j);
@@ -442,7 +442,7 @@ void genRuins(Random &rnd, World &world)
             isLocationUsed(x, y, 30, usedLocations)) {
             continue;
         }
-        usedLocations.emplace_back(x, y);
+        usedLocations.insert({x, y});
         world.placePainting(x, y, *paintingItr);
         --numPlacements;
         if (numPlacements < 0) {
@@ -476,7 +476,7 @@ void genRuins(Random &rnd, World &world)
             isLocationUsed(x, y, 25, usedLocations)) {
             continue;
         }
-        usedLocations.emplace_back(x, y);
+        usedLocations.insert({x, y});
         Chest &chest = world.placeChest(x, y, Variant::shadow);
         fillShadowChest(chest, rnd, world);
         --numPlacements;
@@ -506,7 +506,7 @@ void genRuins(Random &rnd, World &world)
             isLocationUsed(x, y, 25, usedLocations)) {
             continue;
         }
-        usedLocations.emplace_back(x, y);
+        usedLocations.insert({x, y});
         world.placeFramedTile(x, y, TileID::hellforge);
         --numPlacements;
     }
@@ -533,7 +533,7 @@ void genRuins(Random &rnd, World &world)
             isLocationUsed(x, y, 5, usedLocations)) {
             continue;
         }
-        usedLocations.emplace_back(x, y);
+        usedLocations.insert({x, y});
         world.placeFramedTile(x, y, TileID::pot, Variant::underworld);
         --numPlacements;
     }
@@ -109,7 +109,7 @@ void placeSpiderDeco(
     std::shuffle(locations.begin(), locations.end(), rnd.getPRNG());
     auto paintingItr = paintings.begin();
     int numPaintings = rnd.getInt(4, 5);
-    std::vector<Point> usedLocations;
+    LocationIndex usedLocations;
     for (auto [pX, pY] : locations) {
         auto [pWidth, pHeight] = world.getPaintingDims(*paintingItr);
         if (!world.regionPasses(
@@ -124,7 +124,7 @@ void placeSpiderDeco(
             isLocationUsed(pX, pY, 10, usedLocations)) {
             continue;
         }
-        usedLocations.emplace_back(pX, pY);
+        usedLocations.insert({pX, pY});
         world.placePainting(pX - 1, pY + 1, *paintingItr);
         --numPaintings;
         if (numPaintings <= 0) {
@@ -165,7 +165,7 @@ void placeCobwebs(
 Point selectSpiderHallLocation(
     int minX,
     int maxX,
-    TileBuffer &hall,
+    const TileBuffer &hall,
     Random &rnd,
     World &world)
 {
@@ -2,7 +2,6 @@
 
 #include "World.h"
 #include "ids/Paint.h"
-#include "vendor/frozen/set.h"
 #include <cmath>
 
 int makeCongruent(int val, int mod)
@@ -23,162 +22,10 @@ bool isLocationUsed(
     int x,
     int y,
     int radius,
-    const std::vector<Point> &usedLocations,
+    const LocationIndex &usedLocations,
     int maxCount)
 {
-    int count = 0;
-    for (auto [usedX, usedY] : usedLocations) {
-        if (std::hypot(x - usedX, y - usedY) < radius) {
-            ++count;
-            if (count >= maxCount) {
-                return true;
-            }
-        }
-    }
-    return false;
-}
-
-namespace
-{
-constexpr auto nonSolidTiles = frozen::make_set<int>({
-    TileID::empty,
-    TileID::alchemyTable,
-    TileID::altar,
-    TileID::amberTree,
-    TileID::amethystTree,
-    TileID::ashPlant,
-    TileID::ashTree,
-    TileID::ashVines,
-    TileID::banner,
-    TileID::bastStatue,
-    TileID::bathtub,
-    TileID::bed,
-    TileID::bench,
-    TileID::bewitchingTable,
-    TileID::boneWelder,
-    TileID::book,
-    TileID::bookcase,
-    TileID::borealBeam,
-    TileID::bottle,
-    TileID::boulder,
-    TileID::bouncyBoulder,
-    TileID::bubble,
-    TileID::cactusPlant,
-    TileID::campfire,
-    TileID::candelabra,
-    TileID::candle,
-    TileID::catacomb,
-    TileID::chain,
-    TileID::chair,
-    TileID::chandelier,
-    TileID::chest,
-    TileID::chestGroup2,
-    TileID::chimney,
-    TileID::clock,
-    TileID::cobweb,
-    TileID::coral,
-    TileID::corruptPlant,
-    TileID::corruptVines,
-    TileID::crimsonPlant,
-    TileID::crimsonVines,
-    TileID::detonator,
-    TileID::diamondTree,
-    TileID::door,
-    TileID::dresser,
-    TileID::emeraldTree,
-    TileID::explosives,
-    TileID::fallenLog,
-    TileID::fireplace,
-    TileID::flowerVines,
-    TileID::friendlyBoulder,
-    TileID::gem,
-    TileID::geyser,
-    TileID::ghoulder,
-    TileID::goldCoin,
-    TileID::graniteColumn,
-    TileID::grassPlant,
-    TileID::hellforge,
-    TileID::herb,
-    TileID::honeyDrip,
-    TileID::hugeDragonEgg,
-    TileID::junctionBox,
-    TileID::junglePlant,
-    TileID::jungleVines,
-    TileID::lamp,
-    TileID::lantern,
-    TileID::largeJunglePlant,
-    TileID::largePile,
-    TileID::largePileGroup2,
-    TileID::larva,
-    TileID::lavaBoulder,
-    TileID::lavaDrip,
-    TileID::lifeCrystal,
-    TileID::lifeCrystalBoulder,
-    TileID::lihzahrdAltar,
-    TileID::livingLoom,
-    TileID::loom,
-    TileID::manaCrystal,
-    TileID::marbleColumn,
-    TileID::minecartTrack,
-    TileID::mossPlant,
-    TileID::mushroomPlant,
-    TileID::mushroomVines,
-    TileID::orbHeart,
-    TileID::painting2x3,
-    TileID::painting3x2,
-    TileID::painting3x3,
-    TileID::painting6x4,
-    TileID::palmTree,
-    TileID::piano,
-    TileID::platform,
-    TileID::pot,
-    TileID::pressurePlate,
-    TileID::rainbowBoulder,
-    TileID::richMahoganyBeam,
-    TileID::rollingCactus,
-    TileID::rope,
-    TileID::rubyTree,
-    TileID::sakuraTree,
-    TileID::sandDrip,
-    TileID::sandstoneColumn,
-    TileID::sapphireTree,
-    TileID::sensor,
-    TileID::sharpeningStation,
-    TileID::shimmerDrip,
-    TileID::silverCoin,
-    TileID::sink,
-    TileID::skyMill,
-    TileID::sleepingDigtoise,
-    TileID::smallPile,
-    TileID::spiderBoulder,
-    TileID::stalactite,
-    TileID::statue,
-    TileID::sunflower,
-    TileID::table,
-    TileID::tableGroup2,
-    TileID::tallGrassPlant,
-    TileID::tallJunglePlant,
-    TileID::teleporter,
-    TileID::TNTBarrel,
-    TileID::toilet,
-    TileID::tombstone,
-    TileID::topazTree,
-    TileID::torch,
-    TileID::tree,
-    TileID::vineRope,
-    TileID::vines,
-    TileID::waterCandle,
-    TileID::waterDrip,
-    TileID::weatherVane,
-    TileID::woodenBeam,
-    TileID::workBench,
-    TileID::yellowWillowTree,
-});
-}
-
-bool isSolidBlock(int tileId)
-{
-    return !nonSolidTiles.contains(tileId);
+    return usedLocations.countNear(x, y, radius, maxCount) >= maxCount;
 }
 
 bool isInBounds(Point pt, World &world)
@@ -2,6 +2,8 @@
 #define STRUCTUREUTIL_H
 
 #include "Point.h"
+#include "ids/TileTraits.h"
+#include "structures/LocationIndex.h"
 #include <map>
 #include <vector>
 
@@ -15,14 +17,20 @@ int makeCongruent(int val, int mod);
 
 int binLocation(int x, int y, int maxY);
 
+/**
+ * Test if at least maxCount used locations are within the radius.
+ */
 bool isLocationUsed(
     int x,
     int y,
     int radius,
-    const std::vector<Point> &usedLocations,
+    const LocationIndex &usedLocations,
     int maxCount = 1);
 
-bool isSolidBlock(int tileId);
+inline bool isSolidBlock(int tileId)
+{
+    return !blockTraits(tileId).is(BlockTrait::nonSolid);
+}
 
 Point scanWhileEmpty(Point from, Point delta, World &world);
 
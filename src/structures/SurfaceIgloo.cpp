@@ -12,7 +12,7 @@
 #include <algorithm>
 #include <iostream>
 
-bool canPlaceIglooAt(int x, int y, TileBuffer &igloo, World &world)
+bool canPlaceIglooAt(int x, int y, const TileBuffer &igloo, World &world)
 {
     int surfaceLeft =
         scanWhileEmpty({x, world.getSurfaceLevel(x)}, {0, 1}, world).y - y;
@@ -324,14 +324,14 @@ void addTempleTreasures(
     World &world)
 {
     int numChests = world.conf.chests * numRooms / 17.5;
-    std::vector<Point> usedLocations;
+    LocationIndex usedLocations;
     while (numChests > 0) {
         auto [x, y] = rnd.select(locations);
         if (!canPlaceTempleTreasureAt(x, y, world) ||
             isLocationUsed(x, y, 12, usedLocations)) {
             continue;
         }
-        usedLocations.emplace_back(x, y);
+        usedLocations.insert({x, y});
         Chest &chest = world.placeChest(x, y - 2, Variant::lihzahrd);
         fillLihzahrdChest(chest, rnd, world);
         --numChests;
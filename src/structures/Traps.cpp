@@ -201,7 +201,7 @@ void placeSandTraps(Random &rnd, World &world)
          TileID::crimsand,
          TileID::pearlsand,
          TileID::silt});
-    std::vector<Point> usedLocations;
+    LocationIndex usedLocations;
     for (int tries = 50 * numSandTraps; numSandTraps > 0 && tries > 0;
          --tries) {
         int binId = rnd.getInt(minBin, maxBin);
@@ -216,7 +216,7 @@ void placeSandTraps(Random &rnd, World &world)
             continue;
         }
         placePressurePlate(x, trapFloor, true, world);
-        usedLocations.emplace_back(x, trapFloor);
+        usedLocations.insert({x, trapFloor});
         placeWire({x, trapFloor}, {x, y - 1}, Wire::red, world);
         Point prevActuator{-1, -1};
         for (int i = -5; i < 5; ++i) {
@@ -331,7 +331,7 @@ void placeBoulderTraps(Random &rnd, World &world)
                       rnd.getInt(57600, 64000);
     int numFriendly =
         (2000000 + world.getWidth() * world.getHeight()) / 3300000;
-    std::vector<Point> usedLocations;
+    LocationIndex usedLocations;
     for (int tries = 5 * numBoulders; numBoulders > 0 && tries > 0; --tries) {
         auto [x, y] = selectBoulderLocation(rnd, world);
         if (x == -1) {
@@ -357,7 +357,7 @@ void placeBoulderTraps(Random &rnd, World &world)
             isLocationUsed(x, y, 20, usedLocations)) {
             continue;
         }
-        usedLocations.emplace_back(x, y);
+        usedLocations.insert({x, y});
         world.placeFramedTile(
             x,
             y,
@@ -408,7 +408,7 @@ void placeLavaTraps(Random &rnd, World &world)
     if (locations.empty()) {
         return;
     }
-    std::vector<Point> usedLocations;
+    LocationIndex usedLocations;
     double numLavaTraps = world.conf.traps * world.getWidth() *
                           world.getHeight() / rnd.getInt(164000, 230400);
     for (; numLavaTraps > 0; numLavaTraps -= 0.1) {
@@ -451,7 +451,7 @@ void placeLavaTraps(Random &rnd, World &world)
         if (plateLocs.empty()) {
             continue;
         }
-        usedLocations.emplace_back(x, y);
+        usedLocations.insert({x, y});
         for (int j = 0; j < gapJ; ++j) {
             Tile &tile = world.getTile(x, y + j);
             tile.wireRed = true;
@@ -793,7 +793,7 @@ void addOreTraps(std::vector<Point> &&locations, Random &rnd, World &world)
 {
     std::shuffle(locations.begin(), locations.end(), rnd.getPRNG());
     int numTraps = locations.size() / 20;
-    std::vector<Point> usedLocations;
+    LocationIndex usedLocations;
     for (auto [x, y] : locations) {
         if (y < world.getUndergroundLevel()) {
             continue;
@@ -804,7 +804,7 @@ void addOreTraps(std::vector<Point> &&locations, Random &rnd, World &world)
             isLocationUsed(x, y, 40, usedLocations)) {
             continue;
         }
-        usedLocations.emplace_back(x, y);
+        usedLocations.insert({x, y});
         tile.blockID = TileID::explosives;
         world.placeFramedTile(detonator.x, detonator.y, TileID::detonator);
         placeWire({x, y - 1}, {detonator.x, detonator.y + 1}, Wire::red, world);
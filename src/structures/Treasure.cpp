@@ -213,7 +213,7 @@ void placeLifeCrystals(
     int lifeCrystalCount =
         world.conf.lifeCrystals * world.getWidth() * world.getHeight() / 50000;
     int maxDungeonPlacements = 3;
-    std::vector<Point> usedLocations;
+    LocationIndex usedLocations;
     while (lifeCrystalCount > 0) {
         int binId = rnd.getInt(0, maxBin);
         if (locations[binId].empty()) {
@@ -235,7 +235,7 @@ void placeLifeCrystals(
                 isLocationUsed(x, y, 50, usedLocations, 2)) {
                 continue;
             } else {
-                usedLocations.emplace_back(x, y);
+                usedLocations.insert({x, y});
                 double threshold = world.conf.traps > 14
                                        ? 0.0076 * world.conf.traps + 0.036
                                        : 0;
@@ -301,7 +301,7 @@ void placeAltars(int maxBin, LocationBins &locations, Random &rnd, World &world)
          TileID::crimsandstone,
          TileID::hardenedCrimsand,
          TileID::flesh});
-    std::vector<Point> usedLocations;
+    LocationIndex usedLocations;
     for (int tries = 400 * altarCount; altarCount > 0 && tries > 0; --tries) {
         int binId = rnd.getInt(0, maxBin);
         if (locations[binId].empty()) {
@@ -323,14 +323,14 @@ void placeAltars(int maxBin, LocationBins &locations, Random &rnd, World &world)
             isPlacementCandidate(x - 1, y, world) &&
             !isLocationUsed(x, y, 5, usedLocations)) {
             world.placeFramedTile(x - 1, y - 2, TileID::altar, type);
-            usedLocations.emplace_back(x, y);
+            usedLocations.insert({x, y});
             --altarCount;
         }
     }
 }
 
 Point selectPurityAltarLocation(
-    TileBuffer &altar,
+    const TileBuffer &altar,
     int lavaLevel,
     Random &rnd,
     World &world)
@@ -369,7 +369,7 @@ Point selectPurityAltarLocation(
     }
 }
 
-Point scanForAltarOffset(TileBuffer &altar)
+Point scanForAltarOffset(const TileBuffer &altar)
 {
     for (int i = 0; i < altar.getWidth(); ++i) {
         for (int j = 0; j < altar.getHeight(); ++j) {
@@ -587,7 +587,7 @@ void placeLarvae(int maxBin, LocationBins &locations, Random &rnd, World &world)
          WallID::Unsafe::greenTiled,
          WallID::Unsafe::pinkTiled,
          WallID::Unsafe::hive});
-    std::vector<Point> usedLocations;
+    LocationIndex usedLocations;
     while (larvaCount > 0) {
         int binId = rnd.getInt(0, maxBin);
         if (locations[binId].empty()) {
@@ -601,7 +601,7 @@ void placeLarvae(int maxBin, LocationBins &locations, Random &rnd, World &world)
             isPlacementCandidate(x + 2, y, world) &&
             !isLocationUsed(x, y, 35, usedLocations)) {
             world.placeFramedTile(x, y - 3, TileID::larva);
-            usedLocations.emplace_back(x, y);
+            usedLocations.insert({x, y});
             --larvaCount;
         }
     }
@@ -616,9 +616,9 @@ void placeManaCrystals(
     int manaCrystalCount = world.conf.manaCrystals *
                            (world.conf.hiveQueen ? 2 : 1) * world.getWidth() *
                            world.getHeight() / 310000;
-    std::vector<Point> usedLocations;
+    LocationIndex usedLocations;
     for (auto &chest : world.getChests()) {
-        usedLocations.emplace_back(chest.x, chest.y);
+        usedLocations.insert({chest.x, chest.y});
     }
     while (manaCrystalCount > 0) {
         int binId = rnd.getInt(0, maxBin);
@@ -629,7 +629,7 @@ void placeManaCrystals(
         if (isLocationUsed(x, y, 8, usedLocations)) {
             continue;
         }
-        usedLocations.emplace_back(x, y);
+        usedLocations.insert({x, y});
         int probeWall = world.getTile(x, y - 2).wallID;
         if ((y > world.getUndergroundLevel() ||
              (world.conf.hiveQueen &&
@@ -645,8 +645,8 @@ void placeManaCrystals(
 }
 
 Point selectShrineLocation(
-    TileBuffer &shrine,
-    std::vector<Point> &usedLocations,
+    const TileBuffer &shrine,
+    LocationIndex &usedLocations,
     Random &rnd,
     World &world)
 {
@@ -781,7 +781,7 @@ void placeJungleShrines(Random &rnd, World &world)
     int shrineCount = world.conf.chests * (world.conf.hiveQueen ? 1.4 : 1) *
                       world.getWidth() * world.getHeight() /
                       rnd.getInt(590700, 677600);
-    std::vector<Point> usedLocations;
+    LocationIndex usedLocations;
     std::vector<int> shrines(Data::shrines.begin(), Data::shrines.end());
     std::shuffle(shrines.begin(), shrines.end(), rnd.getPRNG());
     for (int tries = 2 * shrineCount; shrineCount > 0 && tries > 0; --tries) {
@@ -791,7 +791,7 @@ void placeJungleShrines(Random &rnd, World &world)
         if (x == -1) {
             continue;
         }
-        usedLocations.emplace_back(x, y);
+        usedLocations.insert({x, y});
         bool isHallow = !world.regionPasses(
             x,
             y,
@@ -1121,9 +1121,9 @@ void placeChests(int maxBin, LocationBins &locations, Random &rnd, World &world)
     int chestCount =
         world.conf.chests * world.getWidth() * world.getHeight() / 41800 -
         world.getChests().size();
-    std::vector<Point> usedLocations{world.spawn};
+    LocationIndex usedLocations{world.spawn};
     for (auto &chest : world.getChests()) {
-        usedLocations.emplace_back(chest.x, chest.y);
+        usedLocations.insert({chest.x, chest.y});
     }
     while (chestCount > 0) {
         int binId = rnd.getInt(0, maxBin);
@@ -1172,7 +1172,7 @@ void placeChests(int maxBin, LocationBins &locations, Random &rnd, World &world)
                 type = Variant::deadMans;
             }
         }
-        usedLocations.emplace_back(x, y);
+        usedLocations.insert({x, y});
         if (type == Variant::gold ||
             (origType == Variant::gold && world.conf.traps > 1.8)) {
             maybePlaceCabinForChest(x, y, rnd, world);
@@ -1249,7 +1249,7 @@ void placePals(int maxBin, LocationBins &locations, Random &rnd, World &world)
 {
     int digtoiseCount =
         world.getWidth() * world.getHeight() / rnd.getInt(1646000, 2304000);
-    std::vector<Point> usedLocations;
+    LocationIndex usedLocations;
     while (digtoiseCount > 0) {
         int binId = rnd.getInt(0, maxBin);
         if (locations[binId].empty()) {
@@ -1270,7 +1270,7 @@ void placePals(int maxBin, LocationBins &locations, Random &rnd, World &world)
             isLocationUsed(x, y, 20, usedLocations)) {
             continue;
         }
-        usedLocations.emplace_back(x, y);
+        usedLocations.insert({x, y});
         if (isPlacementCandidate(x, y, world)) {
             world.placeFramedTile(x, y - 2, TileID::sleepingDigtoise);
             --digtoiseCount;
@@ -1312,7 +1312,7 @@ void placePals(int maxBin, LocationBins &locations, Random &rnd, World &world)
             isLocationUsed(x, y, 40, usedLocations)) {
             continue;
         }
-        usedLocations.emplace_back(x, y);
+        usedLocations.insert({x, y});
         if (isPlacementCandidate(x, y, world)) {
             world.placeFramedTile(x, y - 2, TileID::hugeDragonEgg);
             for (int i = -5; i < 7; ++i) {
@@ -4,6 +4,7 @@
 #include "Util.h"
 #include "World.h"
 #include "ids/Paint.h"
+#include "ids/TileTraits.h"
 #include "ids/WallID.h"
 #include "vendor/frozen/map.h"
 #include "vendor/frozen/set.h"
@@ -193,52 +194,11 @@ void embedGem(int x, int y, uint32_t randInt, World &world)
 void genVines(Random &rnd, World &world)
 {
     std::cout << "Growing vines\n";
-    constexpr auto vineTypes = frozen::make_map<int, int>(
-        {{TileID::grass, TileID::vines},
-         {TileID::leaf, TileID::vines},
-         {TileID::jungleGrass, TileID::jungleVines},
-         {TileID::mahoganyLeaf, TileID::jungleVines},
-         {TileID::lihzahrdBrick, TileID::jungleVines},
-         {TileID::livingMahogany, TileID::vineRope},
-         {TileID::corruptGrass, TileID::corruptVines},
-         {TileID::corruptJungleGrass, TileID::corruptVines},
-         {TileID::crimsonGrass, TileID::crimsonVines},
-         {TileID::crimsonJungleGrass, TileID::crimsonVines},
-         {TileID::hallowedGrass, TileID::hallowedVines},
-         {TileID::mushroomGrass, TileID::mushroomVines},
-         {TileID::ashGrass, TileID::ashVines}});
-    constexpr auto dropperTypes = frozen::make_map<int, int>(
-        {{TileID::dirt, TileID::waterDrip},
-         {TileID::stone, TileID::waterDrip},
-         {TileID::jungleGrass, TileID::waterDrip},
-         {TileID::cloud, TileID::waterDrip},
-         {TileID::rainCloud, TileID::waterDrip},
-         {TileID::granite, TileID::waterDrip},
-         {TileID::marble, TileID::waterDrip},
-         {TileID::livingMahogany, TileID::waterDrip},
-         {TileID::mahoganyLeaf, TileID::waterDrip},
-         {TileID::lihzahrdBrick, TileID::waterDrip},
-         {TileID::ash, TileID::lavaDrip},
-         {TileID::ashGrass, TileID::lavaDrip},
-         {TileID::obsidianBrick, TileID::lavaDrip},
-         {TileID::hellstoneBrick, TileID::lavaDrip},
-         {TileID::sand, TileID::sandDrip},
-         {TileID::hardenedSand, TileID::sandDrip},
-         {TileID::sandstone, TileID::sandDrip},
-         {TileID::ebonsand, TileID::sandDrip},
-         {TileID::hardenedEbonsand, TileID::sandDrip},
-         {TileID::ebonsandstone, TileID::sandDrip},
-         {TileID::crimsand, TileID::sandDrip},
-         {TileID::hardenedCrimsand, TileID::sandDrip},
-         {TileID::crimsandstone, TileID::sandDrip},
-         {TileID::pearlsand, TileID::sandDrip},
-         {TileID::hardenedPearlsand, TileID::sandDrip},
-         {TileID::pearlsandstone, TileID::sandDrip},
-         {TileID::aetherium, TileID::shimmerDrip},
-         {TileID::hive, TileID::honeyDrip}});
     int lavaLevel =
         (world.getCavernLevel() + 2 * world.getUnderworldLevel()) / 3;
-    parallelFor(std::views::iota(0, world.getWidth()), [&](int x) {
+    // Gems and rope check tiles that earlier columns may have grown into, so
+    // columns run in order to keep the result independent of thread count.
+    for (int x = 0; x < world.getWidth(); ++x) {
         int vine = TileID::empty;
         int vinePaint = Paint::none;
         int dropper = TileID::empty;
@@ -284,17 +244,14 @@ void genVines(Random &rnd, World &world)
             if (tile.slope != Slope::none || tile.actuated) {
                 continue;
             }
-            auto vineItr = vineTypes.find(tile.blockID);
-            if (vineItr == vineTypes.end() ||
+            const BlockTraits &traits = blockTraits(tile.blockID);
+            if (traits.vine == TileID::empty ||
                 (tile.blockID == TileID::lihzahrdBrick ? randInt % 29 != 0
                                                        : randInt % 3 == 0)) {
-                auto dropperItr = dropperTypes.find(tile.blockID);
-                if (dropperItr != dropperTypes.end()) {
-                    dropper = dropperItr->second;
-                }
+                dropper = traits.dropper;
                 continue;
             }
-            vine = vineItr->second;
+            vine = traits.vine;
             if (vine == TileID::vines && rnd.getCoarseNoise(x, y) > 0.12) {
                 vine = TileID::flowerVines;
             } else if (
@@ -306,8 +263,8 @@ void genVines(Random &rnd, World &world)
             vinePaint =
                 vine == TileID::vineRope && tile.blockPaint == Paint::none
                     ? Paint::lime
-                    : tile.blockPaint;
+                    : int{tile.blockPaint};
             vineLen = 4 + randInt % 7;
         }
-    });
+    }
 }
@@ -87,7 +87,7 @@ bool isTeleporterLocation(int x, int y, int minX, int maxX, World &world)
 Point selectTeleporterLocation(
     int maxBin,
     const LocationBins &locations,
-    const std::vector<Point> &usedLocations,
+    const LocationIndex &usedLocations,
     int minX,
     int maxX,
     Random &rnd,
@@ -134,7 +134,7 @@ void genTeleporters(const LocationBins &locations, Random &rnd, World &world)
     if (!showProgress) {
         std::cout << '\n';
     }
-    std::vector<Point> usedLocations{world.spawn};
+    LocationIndex usedLocations{world.spawn};
     int maxBin =
         binLocation(world.getWidth(), world.getHeight(), world.getHeight());
     for (int remaining = world.conf.teleporters; remaining > 0; --remaining) {
@@ -155,7 +155,7 @@ void genTeleporters(const LocationBins &locations, Random &rnd, World &world)
         if (from.x == -1) {
             continue;
         }
-        usedLocations.push_back(from);
+        usedLocations.insert(from);
         if (rnd.getStableUint(from.x, from.y) % 3 != 0) {
             minX = from.x - world.getHeight();
             maxX = from.x + world.getHeight();
@@ -171,7 +171,7 @@ void genTeleporters(const LocationBins &locations, Random &rnd, World &world)
         if (to.x == -1) {
             continue;
         }
-        usedLocations.push_back(to);
+        usedLocations.insert(to);
 
         std::vector<Point> path = findPath(
             from + Point{1, -2},
@@ -3,9 +3,7 @@
 namespace
 {
 // clang-format off
-std::vector<std::vector<uint16_t>> altarData{
-// corruptAltar1
-{
+constexpr uint16_t corruptAltar1[]{
     5386, 4106, 189, 2, 4097, 152, 0, 4097, 152, 4097, 189, 2, 4097, 152, 4096,
     157, 4097, 152, 4097, 189, 2, 4097, 152, 4096, 157, 4097, 152, 4097, 189,
     2, 4097, 152, 0, 4097, 152, 4097, 189, 2, 4097, 152, 0, 4097, 152, 4097,
@@ -20,9 +18,9 @@ std::vector<std::vector<uint16_t>> altarData{
     4097, 152, 0, 4097, 152, 4097, 189, 2, 4097, 152, 4096, 157, 4097, 152,
     4097, 189, 2, 4097, 152, 4096, 157, 4097, 152, 4097, 189, 2, 4097, 152, 0,
     4097, 152, 4106, 189
-},
-// corruptAltar2
-{
+};
+
+constexpr uint16_t corruptAltar2[]{
     4874, 4106, 189, 2, 4096, 152, 36864, 152, 40, 2, 4097, 189, 4096, 93, 0,
     1782, 4096, 93, 0, 1800, 4096, 93, 0, 1818, 4097, 152, 2, 4097, 189, 2,
     4097, 152, 2, 4097, 189, 2, 36864, 152, 16, 4097, 152, 1, 4097, 189, 3,
@@ -34,9 +32,9 @@ std::vector<std::vector<uint16_t>> altarData{
     36864, 152, 24, 4097, 152, 1, 4097, 189, 2, 4097, 152, 2, 4097, 189, 4096,
     93, 0, 1782, 4096, 93, 0, 1800, 4096, 93, 0, 1818, 4097, 152, 2, 4097, 189,
     2, 4096, 152, 36864, 152, 32, 2, 4106, 189
-},
-// corruptAltar3
-{
+};
+
+constexpr uint16_t corruptAltar3[]{
     5392, 4112, 189, 2, 4096, 152, 9, 4097, 189, 1, 36864, 152, 8, 4096, 152,
     7, 4097, 152, 4097, 189, 1, 4096, 152, 4096, 140, 8199, 35, 4097, 152,
     4097, 189, 0, 36864, 152, 8, 4096, 152, 4096, 140, 8194, 35, 12288, 4, 0,
@@ -57,9 +55,9 @@ std::vector<std::vector<uint16_t>> altarData{
     35, 4097, 152, 4097, 189, 1, 4096, 152, 4096, 140, 8199, 35, 4097, 152,
     4097, 189, 1, 36864, 152, 8, 4096, 152, 7, 4097, 152, 4097, 189, 2, 4096,
     152, 9, 4112, 189
-},
-// corruptAltar4
-{
+};
+
+constexpr uint16_t corruptAltar4[]{
     5396, 4116, 189, 14, 36864, 140, 8, 4096, 140, 4096, 152, 4097, 189, 14,
     36864, 140, 8, 4097, 152, 4097, 189, 14, 4096, 140, 4097, 152, 4097, 189,
     11, 4097, 140, 4099, 152, 4097, 189, 11, 36864, 140, 8, 4100, 152, 4097,
@@ -80,9 +78,9 @@ std::vector<std::vector<uint16_t>> altarData{
     2048, 36864, 474, 2088, 0, 36864, 474, 2072, 36864, 474, 2048, 36864, 474,
     2080, 4, 4096, 140, 4097, 152, 4097, 189, 4, 36864, 474, 2064, 36864, 474,
     2048, 36864, 474, 2080, 6, 4097, 140, 4096, 152, 4116, 189
-},
-// corruptAltar5
-{
+};
+
+constexpr uint16_t corruptAltar5[]{
     3852, 4108, 189, 1, 4096, 215, 54, 0, 4096, 215, 54, 18, 4101, 152, 4097,
     189, 1, 4096, 215, 72, 0, 4096, 215, 72, 18, 4096, 140, 4098, 152, 4096,
     140, 4096, 152, 4097, 189, 1, 4096, 215, 90, 0, 4096, 215, 90, 18, 4101,
@@ -96,9 +94,9 @@ std::vector<std::vector<uint16_t>> altarData{
     4101, 152, 4097, 189, 1, 4096, 215, 72, 0, 4096, 215, 72, 18, 4096, 140,
     4098, 152, 4096, 140, 4096, 152, 4097, 189, 1, 4096, 215, 90, 0, 4096, 215,
     90, 18, 4101, 152, 4108, 189
-},
-// corruptAltar6
-{
+};
+
+constexpr uint16_t corruptAltar6[]{
     3856, 4112, 189, 2, 4096, 152, 8, 4096, 152, 4097, 189, 4096, 93, 0, 1782,
     4096, 93, 0, 1800, 4096, 93, 0, 1818, 4097, 152, 6, 4097, 152, 4097, 189,
     2, 4098, 152, 36864, 140, 24, 4098, 140, 36864, 140, 40, 4098, 152, 4097,
@@ -114,9 +112,9 @@ std::vector<std::vector<uint16_t>> altarData{
     36864, 140, 32, 4098, 152, 4097, 189, 4096, 93, 0, 1782, 4096, 93, 0, 1800,
     4096, 93, 0, 1818, 4097, 152, 6, 4097, 152, 4097, 189, 2, 4096, 152, 8,
     4096, 152, 4112, 189
-},
-// crimsonAltar1
-{
+};
+
+constexpr uint16_t crimsonAltar1[]{
     4361, 4105, 189, 2, 8192, 141, 4098, 478, 4097, 189, 1, 8193, 141, 45056,
     478, 234, 8, 4097, 478, 4097, 189, 1, 8193, 141, 45056, 478, 234, 8, 4097,
     478, 4097, 189, 0, 12288, 4, 0, 242, 141, 8193, 141, 4098, 478, 4097, 189,
@@ -130,9 +128,9 @@ std::vector<std::vector<uint16_t>> altarData{
     12288, 4, 0, 242, 141, 8193, 141, 45056, 478, 234, 8, 4097, 478, 4097, 189,
     1, 8193, 141, 4098, 478, 4097, 189, 1, 8193, 141, 4096, 478, 8192, 234,
     4096, 478, 4097, 189, 2, 8192, 141, 4098, 478, 4105, 189
-},
-// crimsonAltar2
-{
+};
+
+constexpr uint16_t crimsonAltar2[]{
     4361, 4105, 189, 3, 4098, 347, 4097, 189, 3, 4098, 347, 4097, 189, 3, 4098,
     347, 4097, 189, 0, 36864, 347, 8, 4097, 347, 4098, 478, 4097, 189, 0,
     36864, 347, 8, 4097, 347, 4098, 478, 4097, 189, 0, 36864, 347, 8, 4097,
@@ -143,9 +141,9 @@ std::vector<std::vector<uint16_t>> altarData{
     347, 8, 4097, 347, 4098, 478, 4097, 189, 0, 36864, 347, 8, 4097, 347, 4098,
     478, 4097, 189, 3, 4098, 347, 4097, 189, 3, 4098, 347, 4097, 189, 3, 4098,
     347, 4105, 189
-},
-// crimsonAltar3
-{
+};
+
+constexpr uint16_t crimsonAltar3[]{
     5393, 4113, 189, 4, 36864, 195, 2072, 36864, 195, 2048, 36864, 195, 2088,
     6, 4097, 189, 2, 36864, 195, 2072, 36867, 195, 2048, 0, 36864, 195, 2072,
     36864, 195, 2048, 36864, 195, 2088, 0, 4097, 478, 4097, 189, 2, 36873, 195,
@@ -170,9 +168,9 @@ std::vector<std::vector<uint16_t>> altarData{
     2048, 0, 36866, 195, 2048, 36864, 195, 2080, 4097, 478, 4097, 189, 4,
     36869, 195, 2048, 1, 4097, 478, 4097, 189, 6, 36864, 195, 2064, 36865, 195,
     2048, 36864, 195, 2080, 3, 4113, 189
-},
-// crimsonAltar4
-{
+};
+
+constexpr uint16_t crimsonAltar4[]{
     3851, 4107, 189, 4096, 215, 216, 0, 4096, 215, 216, 18, 4096, 347, 4097,
     478, 36864, 208, 40, 36864, 208, 24, 4097, 478, 4097, 189, 4096, 215, 234,
     0, 4096, 215, 234, 18, 4096, 347, 4097, 478, 4097, 208, 4097, 478, 4097,
@@ -188,9 +186,9 @@ std::vector<std::vector<uint16_t>> altarData{
     478, 4097, 208, 4097, 478, 4097, 189, 4096, 215, 252, 0, 4096, 215, 252,
     18, 4096, 347, 4097, 478, 36864, 208, 32, 36864, 208, 16, 4097, 478, 4107,
     189
-},
-// crimsonAltar5
-{
+};
+
+constexpr uint16_t crimsonAltar5[]{
     4361, 4105, 189, 3, 36864, 347, 40, 1, 4097, 189, 2, 36864, 478, 24, 4096,
     478, 1, 4097, 189, 4096, 93, 0, 162, 4096, 93, 0, 180, 4096, 93, 0, 198,
     4097, 478, 36864, 347, 40, 0, 4097, 189, 2, 36864, 478, 16, 4097, 478, 0,
@@ -202,9 +200,9 @@ std::vector<std::vector<uint16_t>> altarData{
     24, 4097, 478, 0, 4097, 189, 4096, 93, 0, 162, 4096, 93, 0, 180, 4096, 93,
     0, 198, 4097, 478, 36864, 347, 32, 0, 4097, 189, 2, 36864, 478, 16, 4096,
     478, 1, 4097, 189, 3, 36864, 347, 32, 1, 4105, 189
-},
-// crimsonAltar6
-{
+};
+
+constexpr uint16_t crimsonAltar6[]{
     4878, 4110, 189, 9, 36864, 478, 8, 4096, 478, 4097, 189, 9, 4097, 478,
     4097, 189, 6, 36864, 478, 8, 4096, 478, 4096, 208, 4097, 478, 4097, 189, 3,
     4096, 93, 0, 162, 4096, 93, 0, 180, 4096, 93, 0, 198, 4097, 478, 4096, 208,
@@ -223,9 +221,16 @@ std::vector<std::vector<uint16_t>> altarData{
     0, 180, 4096, 93, 0, 198, 4097, 478, 4096, 208, 4097, 478, 4097, 189, 6,
     36864, 478, 8, 4096, 478, 4096, 208, 4097, 478, 4097, 189, 9, 4097, 478,
     4097, 189, 9, 36864, 478, 8, 4096, 478, 4110, 189
-},
+};
+
+constexpr std::span<const uint16_t> altarData[]{
+    corruptAltar1, corruptAltar2, corruptAltar3, corruptAltar4, corruptAltar5,
+    corruptAltar6, crimsonAltar1, crimsonAltar2, crimsonAltar3, crimsonAltar4,
+    crimsonAltar5, crimsonAltar6
 };
 // clang-format on
+
+TileBufferCache altarCache{altarData};
 } // namespace
 
 namespace Data
@@ -233,7 +238,7 @@ namespace Data
 
 TileBuffer getAltar(int altarId, const FramedBitset &framedTiles)
 {
-    return {altarData[altarId].data(), framedTiles};
+    return altarCache.get(altarId, framedTiles);
 }
 
 } // namespace Data
@@ -3,70 +3,74 @@
 namespace
 {
 // clang-format off
-std::vector<std::vector<uint16_t>> balloonData{
-// balloon1
-{
+constexpr uint16_t balloon1[]{
     1287, 0, 4099, 446, 1, 4100, 446, 36864, 446, 40, 36864, 446, 24, 4107,
     446, 36864, 446, 32, 36864, 446, 16, 0, 4099, 446, 1
-},
-// balloon2
-{
+};
+
+constexpr uint16_t balloon2[]{
     1289, 0, 4100, 446, 2, 4102, 446, 36864, 446, 24, 4112, 446, 36864, 446,
     16, 4096, 446, 0, 4100, 446, 2
-},
-// balloon3
-{
+};
+
+constexpr uint16_t balloon3[]{
     1287, 0, 4099, 446, 1, 4101, 446, 36864, 446, 24, 4108, 446, 36864, 446,
     16, 0, 4099, 446, 1
-},
-// balloon4
-{
+};
+
+constexpr uint16_t balloon4[]{
     1803, 1, 4099, 446, 5, 4102, 446, 2, 4104, 446, 36864, 446, 24, 4116, 446,
     36864, 446, 16, 4096, 446, 0, 4102, 446, 4, 4099, 446, 4
-},
-// balloon5
-{
+};
+
+constexpr uint16_t balloon5[]{
     1802, 0, 4100, 446, 3, 4103, 446, 1, 4104, 446, 36864, 446, 24, 4114, 446,
     36864, 446, 16, 4103, 446, 2, 4100, 446, 3
-},
-// balloon6
-{
+};
+
+constexpr uint16_t balloon6[]{
     2316, 1, 4100, 446, 5, 4103, 446, 2, 4105, 446, 1, 4105, 446, 36864, 446,
     24, 4118, 446, 36864, 446, 16, 4106, 446, 2, 4103, 446, 4, 4100, 446, 4
-},
-// balloon7
-{
+};
+
+constexpr uint16_t balloon7[]{
     2317, 1, 4099, 446, 7, 4102, 446, 4, 4105, 446, 2, 4105, 446, 36864, 446,
     40, 36864, 446, 24, 4119, 446, 36864, 446, 32, 36864, 446, 16, 4106, 446,
     3, 4102, 446, 6, 4099, 446, 6
-},
-// balloon8
-{
+};
+
+constexpr uint16_t balloon8[]{
     2316, 1, 4099, 446, 6, 4102, 446, 3, 4105, 446, 1, 4106, 446, 36864, 446,
     24, 4118, 446, 36864, 446, 16, 4105, 446, 2, 4102, 446, 5, 4099, 446, 5
-},
-// balloon9
-{
+};
+
+constexpr uint16_t balloon9[]{
     2832, 2, 4100, 446, 9, 4103, 446, 6, 4105, 446, 5, 4107, 446, 2, 36864,
     446, 8, 4108, 446, 36864, 446, 24, 4096, 446, 36864, 446, 8, 4110, 446,
     36864, 446, 8, 4108, 446, 36864, 446, 16, 4096, 446, 0, 4107, 446, 3, 4105,
     446, 6, 4103, 446, 8, 4100, 446, 7
-},
-// balloon10
-{
+};
+
+constexpr uint16_t balloon10[]{
     2317, 1, 4100, 446, 6, 4103, 446, 3, 4106, 446, 1, 4106, 446, 36864, 446,
     40, 36864, 446, 24, 4119, 446, 36864, 446, 32, 36864, 446, 16, 4106, 446,
     2, 4103, 446, 5, 4100, 446, 5
-},
-// balloon11
-{
+};
+
+constexpr uint16_t balloon11[]{
     2832, 2, 4101, 446, 8, 4104, 446, 5, 4107, 446, 3, 4108, 446, 1, 36864,
     446, 8, 4108, 446, 36864, 446, 40, 36864, 446, 24, 36864, 446, 8, 4110,
     446, 36864, 446, 8, 4108, 446, 36864, 446, 32, 36864, 446, 16, 0, 4108,
     446, 2, 4107, 446, 4, 4104, 446, 7, 4101, 446, 6
-},
+};
+
+constexpr std::span<const uint16_t> balloonData[]{
+    balloon1, balloon2, balloon3, balloon4, balloon5, balloon6, balloon7,
+    balloon8, balloon9, balloon10, balloon11
 };
 // clang-format on
+
+TileBufferCache balloonCache{balloonData};
 } // namespace
 
 namespace Data
@@ -75,7 +79,7 @@ namespace Data
 TileBuffer
 getBalloon(int id, int tileId, int paint, const FramedBitset &framedTiles)
 {
-    TileBuffer data{balloonData[id].data(), framedTiles};
+    TileBuffer data = balloonCache.get(id, framedTiles);
     for (int i = 0; i < data.getWidth(); ++i) {
         for (int j = 0; j < data.getHeight(); ++j) {
             Tile &tile = data.getTile(i, j);
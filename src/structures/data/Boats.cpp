@@ -3,9 +3,7 @@
 namespace
 {
 // clang-format off
-std::vector<std::vector<uint16_t>> boatData{
-// frozenBoat1
-{
+constexpr uint16_t frozenBoat1[]{
     20514, 12, 20480, 158, 28, 53248, 158, 28, 24, 30, 20482, 158, 28, 30,
     53248, 158, 28, 16, 20482, 158, 28, 53248, 158, 28, 40, 29, 20487, 158, 28,
     53248, 158, 28, 40, 26, 53248, 158, 28, 16, 20484, 158, 28, 4097, 321,
@@ -164,9 +162,14 @@ std::vector<std::vector<uint16_t>> boatData{
     7168, 24, 4096, 321, 36864, 321, 32, 24, 4096, 213, 12288, 213, 245, 8192,
     150, 4099, 321, 36864, 321, 32, 26, 12288, 213, 245, 8192, 150, 4097, 321,
     36864, 321, 32, 28, 4098, 321, 36864, 321, 32, 29, 4096, 321, 12
-},
+};
+
+constexpr std::span<const uint16_t> boatData[]{
+    frozenBoat1
 };
 // clang-format on
+
+TileBufferCache boatCache{boatData};
 } // namespace
 
 namespace Data
@@ -174,7 +177,7 @@ namespace Data
 
 TileBuffer getBoat(Boat boatId, const FramedBitset &framedTiles)
 {
-    return {boatData[static_cast<int>(boatId)].data(), framedTiles};
+    return boatCache.get(static_cast<int>(boatId), framedTiles);
 }
 
 } // namespace Data
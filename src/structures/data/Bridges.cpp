@@ -3,9 +3,7 @@
 namespace
 {
 // clang-format off
-std::vector<std::vector<uint16_t>> bridgeData{
-// underworldBridge1
-{
+constexpr uint16_t underworldBridge1[]{
     12299, 0, 8193, 245, 4097, 75, 6, 8193, 245, 4097, 75, 6, 8193, 245, 4097,
     75, 5, 8194, 245, 4097, 75, 6, 8193, 245, 4097, 75, 5, 4096, 93, 0, 1242,
     12288, 93, 0, 1260, 245, 12288, 93, 0, 1278, 245, 4097, 75, 6, 8193, 245,
@@ -30,9 +28,14 @@ std::vector<std::vector<uint16_t>> bridgeData{
     93, 0, 1278, 245, 4097, 75, 6, 8193, 245, 4097, 75, 5, 8194, 245, 4097, 75,
     6, 8193, 245, 4097, 75, 6, 8193, 245, 4097, 75, 6, 8193, 245, 4097, 75, 5,
     8194, 245, 4097, 75, 5
-},
+};
+
+constexpr std::span<const uint16_t> bridgeData[]{
+    underworldBridge1
 };
 // clang-format on
+
+TileBufferCache bridgeCache{bridgeData};
 } // namespace
 
 namespace Data
@@ -40,7 +43,7 @@ namespace Data
 
 TileBuffer getBridge(const FramedBitset &framedTiles)
 {
-    return {bridgeData[0].data(), framedTiles};
+    return bridgeCache.get(0, framedTiles);
 }
 
 } // namespace Data
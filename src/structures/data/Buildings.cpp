@@ -3,9 +3,7 @@
 namespace
 {
 // clang-format off
-std::vector<std::vector<uint16_t>> buildingData{
-// desertTomb1
-{
+constexpr uint16_t desertTomb1[]{
     13340, 15, 53248, 274, 14, 24, 20490, 274, 14, 15, 20491, 274, 14, 7,
     53248, 274, 14, 24, 20498, 274, 14, 7, 20499, 274, 14, 53248, 274, 14, 24,
     20521, 274, 14, 28681, 274, 34, 3598, 20497, 274, 14, 28672, 274, 34, 3598,
@@ -128,9 +126,9 @@ std::vector<std::vector<uint16_t>> buildingData{
     34, 3598, 20497, 274, 14, 28681, 274, 34, 3598, 20482, 274, 14, 53248, 274,
     14, 16, 20506, 274, 14, 7, 20499, 274, 14, 7, 53248, 274, 14, 16, 20498,
     274, 14, 15, 20491, 274, 14, 15, 53248, 274, 14, 16, 20490, 274, 14
-},
-// desertTomb2
-{
+};
+
+constexpr uint16_t desertTomb2[]{
     13340, 15, 53248, 274, 14, 24, 20490, 274, 14, 15, 20491, 274, 14, 7,
     53248, 274, 14, 24, 20498, 274, 14, 7, 20499, 274, 14, 53248, 274, 14, 24,
     20521, 274, 14, 28681, 274, 34, 3598, 20497, 274, 14, 28672, 274, 34, 3598,
@@ -253,9 +251,9 @@ std::vector<std::vector<uint16_t>> buildingData{
     14, 28681, 274, 34, 3598, 20482, 274, 14, 53248, 274, 14, 16, 20506, 274,
     14, 7, 20499, 274, 14, 7, 53248, 274, 14, 16, 20498, 274, 14, 15, 20491,
     274, 14, 15, 53248, 274, 14, 16, 20490, 274, 14
-},
-// desertTomb3
-{
+};
+
+constexpr uint16_t desertTomb3[]{
     13340, 15, 53248, 274, 14, 24, 20490, 274, 14, 15, 20491, 274, 14, 7,
     53248, 274, 14, 24, 20498, 274, 14, 7, 20499, 274, 14, 53248, 274, 14, 24,
     20521, 274, 14, 28681, 274, 34, 3598, 20497, 274, 14, 28672, 274, 34, 3598,
@@ -384,9 +382,9 @@ std::vector<std::vector<uint16_t>> buildingData{
     34, 3598, 20497, 274, 14, 28681, 274, 34, 3598, 20482, 274, 14, 53248, 274,
     14, 16, 20506, 274, 14, 7, 20499, 274, 14, 7, 53248, 274, 14, 16, 20498,
     274, 14, 15, 20491, 274, 14, 15, 53248, 274, 14, 16, 20490, 274, 14
-},
-// desertTomb4
-{
+};
+
+constexpr uint16_t desertTomb4[]{
     13340, 15, 53248, 274, 14, 24, 20490, 274, 14, 15, 20491, 274, 14, 7,
     53248, 274, 14, 24, 20498, 274, 14, 7, 20499, 274, 14, 53248, 274, 14, 24,
     20521, 274, 14, 28681, 274, 34, 3598, 20497, 274, 14, 28672, 274, 34, 3598,
@@ -515,9 +513,9 @@ std::vector<std::vector<uint16_t>> buildingData{
     3598, 20497, 274, 14, 28681, 274, 34, 3598, 20482, 274, 14, 53248, 274, 14,
     16, 20506, 274, 14, 7, 20499, 274, 14, 7, 53248, 274, 14, 16, 20498, 274,
     14, 15, 20491, 274, 14, 15, 53248, 274, 14, 16, 20490, 274, 14
-},
-// spiderHall1
-{
+};
+
+constexpr uint16_t spiderHall1[]{
     26923, 23, 36864, 273, 24, 4105, 273, 36864, 273, 40, 2, 4099, 273, 23,
     4096, 273, 12297, 273, 147, 4096, 273, 4096, 42, 0, 0, 4096, 42, 0, 18, 0,
     4099, 273, 11, 36864, 273, 24, 4107, 273, 12298, 273, 147, 8194, 147,
@@ -736,9 +734,9 @@ std::vector<std::vector<uint16_t>> buildingData{
     12290, 273, 147, 8194, 147, 12290, 273, 147, 4096, 273, 23, 4096, 273,
     12290, 273, 147, 4103, 273, 4096, 42, 0, 0, 4096, 42, 0, 18, 0, 4099, 273,
     23, 36864, 273, 16, 4105, 273, 36864, 273, 32, 2, 4099, 273
-},
-// spiderHall2
-{
+};
+
+constexpr uint16_t spiderHall2[]{
     26923, 23, 36864, 273, 24, 4105, 273, 36864, 273, 40, 2, 4099, 273, 23,
     4096, 273, 12297, 273, 147, 4096, 273, 4096, 42, 0, 0, 4096, 42, 0, 18, 0,
     4099, 273, 11, 36864, 273, 24, 4107, 273, 12298, 273, 147, 8194, 147,
@@ -958,9 +956,15 @@ std::vector<std::vector<uint16_t>> buildingData{
     12290, 273, 147, 8194, 147, 12290, 273, 147, 4096, 273, 23, 4096, 273,
     12290, 273, 147, 4103, 273, 4096, 42, 0, 0, 4096, 42, 0, 18, 0, 4099, 273,
     23, 36864, 273, 16, 4105, 273, 36864, 273, 32, 2, 4099, 273
-},
+};
+
+constexpr std::span<const uint16_t> buildingData[]{
+    desertTomb1, desertTomb2, desertTomb3, desertTomb4, spiderHall1,
+    spiderHall2
 };
 // clang-format on
+
+TileBufferCache buildingCache{buildingData};
 } // namespace
 
 namespace Data
@@ -968,7 +972,7 @@ namespace Data
 
 TileBuffer getBuilding(Building buildingId, const FramedBitset &framedTiles)
 {
-    return {buildingData[static_cast<int>(buildingId)].data(), framedTiles};
+    return buildingCache.get(static_cast<int>(buildingId), framedTiles);
 }
 
 } // namespace Data
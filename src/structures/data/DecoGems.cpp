@@ -3,35 +3,38 @@
 namespace
 {
 // clang-format off
-std::vector<std::vector<uint16_t>> gemData{
-// gem1
-{
+constexpr uint16_t gem1[]{
     514, 36867, 267, 2048
-},
-// gem2
-{
+};
+
+constexpr uint16_t gem2[]{
     514, 36864, 267, 2072, 36864, 267, 2088, 36864, 267, 2064, 36864, 267, 2080
-},
-// gem3
-{
+};
+
+constexpr uint16_t gem3[]{
     515, 36864, 267, 2072, 36864, 267, 2048, 36864, 267, 2088, 36864, 267,
     2064, 36864, 267, 2048, 36864, 267, 2080
-},
-// gem4
-{
+};
+
+constexpr uint16_t gem4[]{
     771, 36864, 267, 2072, 36864, 267, 2048, 36864, 267, 2088, 36866, 267,
     2048, 36864, 267, 2064, 36864, 267, 2048, 36864, 267, 2080
-},
-// gem5
-{
+};
+
+constexpr uint16_t gem5[]{
     514, 36864, 267, 2072, 36865, 267, 2048, 36864, 267, 2080
-},
-// gem6
-{
+};
+
+constexpr uint16_t gem6[]{
     514, 36864, 267, 2048, 36864, 267, 2088, 36864, 267, 2064, 36864, 267, 2048
-},
+};
+
+constexpr std::span<const uint16_t> gemData[]{
+    gem1, gem2, gem3, gem4, gem5, gem6
 };
 // clang-format on
+
+TileBufferCache gemCache{gemData};
 } // namespace
 
 namespace Data
@@ -39,7 +42,7 @@ namespace Data
 
 TileBuffer getDecoGem(int gemId, const FramedBitset &framedTiles)
 {
-    return {gemData[gemId].data(), framedTiles};
+    return gemCache.get(gemId, framedTiles);
 }
 
 } // namespace Data
@@ -5,9 +5,7 @@
 namespace
 {
 // clang-format off
-std::vector<std::vector<uint16_t>> roomData{
-// dungeonEntranceLeft
-{
+constexpr uint16_t dungeonEntranceLeft[]{
     21278, 7, 4100, 41, 5, 4103, 189, 4098, 41, 7, 4096, 41, 12290, 41, 7,
     4096, 41, 8, 4100, 189, 4096, 41, 12289, 41, 7, 7, 4098, 41, 12288, 41, 7,
     4096, 41, 10, 4098, 189, 4096, 41, 12289, 41, 7, 9, 4096, 41, 12288, 41, 7,
@@ -81,9 +79,9 @@ std::vector<std::vector<uint16_t>> roomData{
     12288, 50, 0, 0, 7, 12288, 19, 72, 0, 7, 8192, 7, 12288, 101, 36, 0, 7,
     12288, 101, 36, 18, 7, 12288, 101, 36, 36, 7, 12288, 101, 36, 54, 7, 12290,
     41, 7, 4096, 41, 12316, 41, 7, 4096, 41, 12316, 41, 7, 4125, 41
-},
-// dungeonEntranceRight
-{
+};
+
+constexpr uint16_t dungeonEntranceRight[]{
     21278, 4126, 41, 12316, 41, 7, 4096, 41, 12316, 41, 7, 4099, 41, 12289, 41,
     7, 8202, 7, 12288, 50, 54, 0, 7, 12288, 19, 108, 0, 7, 8192, 7, 12288, 50,
     0, 0, 7, 12288, 19, 54, 0, 7, 8192, 7, 12288, 101, 0, 0, 7, 12288, 101, 0,
@@ -157,9 +155,14 @@ std::vector<std::vector<uint16_t>> roomData{
     12289, 41, 7, 7, 4098, 41, 12288, 41, 7, 4096, 41, 10, 4098, 189, 4096, 41,
     12289, 41, 7, 7, 4096, 41, 12290, 41, 7, 4096, 41, 8, 4100, 189, 4096, 41,
     12289, 41, 7, 7, 4100, 41, 5, 4103, 189, 4098, 41
-},
+};
+
+constexpr std::span<const uint16_t> roomData[]{
+    dungeonEntranceLeft, dungeonEntranceRight
 };
 // clang-format on
+
+TileBufferCache roomCache{roomData};
 } // namespace
 
 namespace Data
@@ -170,7 +173,7 @@ TileBuffer getDungeonRoom(
     Variant furnitureSet,
     const FramedBitset &framedTiles)
 {
-    TileBuffer data{roomData[static_cast<int>(roomId)].data(), framedTiles};
+    TileBuffer data = roomCache.get(static_cast<int>(roomId), framedTiles);
     int themeBrick = TileID::blueBrick;
     int themeWall = WallID::Unsafe::blueBrick;
     if (furnitureSet == Variant::greenDungeon) {
@@ -5,47 +5,45 @@
 namespace
 {
 // clang-format off
-std::vector<std::vector<uint16_t>> furnitureData{
-// furniture1
-{
+constexpr uint16_t furniture1[]{
     1798, 4, 4096, 189, 1, 4096, 93, 0, 0, 4096, 93, 0, 18, 4096, 93, 0, 36,
     4096, 189, 2, 4096, 89, 0, 0, 4096, 89, 0, 18, 4096, 189, 2, 4096, 89, 18,
     0, 4096, 89, 18, 18, 4096, 189, 2, 4096, 89, 36, 0, 4096, 89, 36, 18, 4096,
     189, 1, 4096, 93, 0, 0, 4096, 93, 0, 18, 4096, 93, 0, 36, 4096, 189, 4,
     4096, 189
-},
-// furniture2
-{
+};
+
+constexpr uint16_t furniture2[]{
     1030, 4097, 189, 3, 4096, 189, 4, 4096, 189, 4096, 42, 0, 0, 4096, 42, 0,
     18, 2, 4096, 189, 4
-},
-// furniture3
-{
+};
+
+constexpr uint16_t furniture3[]{
     1030, 4096, 189, 4, 4096, 189, 4096, 42, 0, 0, 4096, 42, 0, 18, 2, 4096,
     189, 4, 4097, 189, 3
-},
-// furniture4
-{
+};
+
+constexpr uint16_t furniture4[]{
     1798, 4096, 189, 4, 4096, 189, 4096, 42, 0, 0, 4096, 42, 0, 18, 2, 4096,
     189, 4, 4096, 189, 4, 4096, 189, 4, 4096, 189, 4096, 42, 0, 0, 4096, 42, 0,
     18, 2, 4096, 189, 4
-},
-// furniture5
-{
+};
+
+constexpr uint16_t furniture5[]{
     1541, 2, 4096, 18, 0, 0, 4096, 189, 1, 4096, 33, 0, 0, 4096, 18, 18, 0,
     4096, 189, 1, 4096, 87, 0, 0, 4096, 87, 0, 18, 4096, 189, 1, 4096, 87, 18,
     0, 4096, 87, 18, 18, 4096, 189, 1, 4096, 87, 36, 0, 4096, 87, 36, 18, 4096,
     189, 3, 4096, 189
-},
-// furniture6
-{
+};
+
+constexpr uint16_t furniture6[]{
     1286, 4, 4096, 189, 2, 4096, 15, 18, 0, 4096, 15, 18, 18, 4096, 189, 2,
     4096, 14, 0, 0, 4096, 14, 0, 18, 4096, 189, 0, 4096, 100, 0, 0, 4096, 100,
     0, 18, 4096, 14, 18, 0, 4096, 14, 18, 18, 4096, 189, 0, 4096, 100, 18, 0,
     4096, 100, 18, 18, 4096, 14, 36, 0, 4096, 14, 36, 18, 4096, 189
-},
-// furniture7
-{
+};
+
+constexpr uint16_t furniture7[]{
     1798, 0, 4096, 101, 0, 0, 4096, 101, 0, 18, 4096, 101, 0, 36, 4096, 101, 0,
     54, 4096, 189, 0, 4096, 101, 18, 0, 4096, 101, 18, 18, 4096, 101, 18, 36,
     4096, 101, 18, 54, 4096, 189, 0, 4096, 101, 36, 0, 4096, 101, 36, 18, 4096,
@@ -54,143 +52,143 @@ std::vector<std::vector<uint16_t>> furnitureData{
     4096, 101, 0, 54, 4096, 189, 0, 4096, 101, 18, 0, 4096, 101, 18, 18, 4096,
     101, 18, 36, 4096, 101, 18, 54, 4096, 189, 0, 4096, 101, 36, 0, 4096, 101,
     36, 18, 4096, 101, 36, 36, 4096, 101, 36, 54, 4096, 189
-},
-// furniture8
-{
+};
+
+constexpr uint16_t furniture8[]{
     2053, 1, 4098, 189, 1, 4096, 79, 72, 0, 4096, 79, 72, 18, 4096, 189, 1,
     4096, 79, 90, 0, 4096, 79, 90, 18, 4096, 189, 1, 4096, 79, 108, 0, 4096,
     79, 108, 18, 4096, 189, 1, 4096, 79, 126, 0, 4096, 79, 126, 18, 4096, 189,
     1, 4096, 21, 0, 0, 4096, 21, 0, 18, 4096, 189, 1, 4096, 21, 18, 0, 4096,
     21, 18, 18, 4096, 189, 3, 4096, 189
-},
-// furniture9
-{
+};
+
+constexpr uint16_t furniture9[]{
     1287, 4096, 189, 5, 4096, 189, 4096, 34, 0, 0, 4096, 34, 0, 18, 4096, 34,
     0, 36, 2, 4096, 189, 4096, 34, 18, 0, 4096, 34, 18, 18, 4096, 34, 18, 36,
     2, 4096, 189, 4096, 34, 36, 0, 4096, 34, 36, 18, 4096, 34, 36, 36, 2, 4096,
     189, 5
-},
-// furniture10
-{
+};
+
+constexpr uint16_t furniture10[]{
     1031, 0, 4096, 104, 0, 0, 4096, 104, 0, 18, 4096, 104, 0, 36, 4096, 104, 0,
     54, 4096, 104, 0, 72, 4096, 189, 0, 4096, 104, 18, 0, 4096, 104, 18, 18,
     4096, 104, 18, 36, 4096, 104, 18, 54, 4096, 104, 18, 72, 4096, 189, 2,
     4096, 105, 0, 162, 4096, 105, 0, 180, 4096, 105, 0, 198, 4096, 189, 2,
     4096, 105, 18, 162, 4096, 105, 18, 180, 4096, 105, 18, 198, 4096, 189
-},
-// furniture11
-{
+};
+
+constexpr uint16_t furniture11[]{
     1797, 0, 4096, 105, 0, 0, 4096, 105, 0, 18, 4096, 105, 0, 36, 4096, 189, 0,
     4096, 105, 18, 0, 4096, 105, 18, 18, 4096, 105, 18, 36, 4096, 189, 1, 4096,
     90, 0, 0, 4096, 90, 0, 18, 4096, 189, 1, 4096, 90, 18, 0, 4096, 90, 18, 18,
     4096, 189, 1, 4096, 90, 36, 0, 4096, 90, 36, 18, 4096, 189, 1, 4096, 90,
     54, 0, 4096, 90, 54, 18, 4096, 189, 0, 4096, 93, 0, 0, 4096, 93, 0, 18,
     4096, 93, 0, 36, 4096, 189
-},
-// furniture12
-{
+};
+
+constexpr uint16_t furniture12[]{
     1030, 4, 4096, 189, 1, 4096, 105, 0, 0, 4096, 105, 0, 18, 4096, 105, 0, 36,
     4096, 189, 1, 4096, 105, 18, 0, 4096, 105, 18, 18, 4096, 105, 18, 36, 4096,
     189, 4, 4096, 189
-},
-// furniture13
-{
+};
+
+constexpr uint16_t furniture13[]{
     2053, 1, 4096, 88, 0, 0, 4096, 88, 0, 18, 4096, 189, 0, 4096, 33, 0, 0,
     4096, 88, 18, 0, 4096, 88, 18, 18, 4096, 189, 1, 4096, 88, 36, 0, 4096, 88,
     36, 18, 4096, 189, 3, 4096, 189, 1, 4096, 79, 0, 0, 4096, 79, 0, 18, 4096,
     189, 1, 4096, 79, 18, 0, 4096, 79, 18, 18, 4096, 189, 1, 4096, 79, 36, 0,
     4096, 79, 36, 18, 4096, 189, 1, 4096, 79, 54, 0, 4096, 79, 54, 18, 4096,
     189
-},
-// furniture14
-{
+};
+
+constexpr uint16_t furniture14[]{
     1285, 2, 4097, 189, 1, 4096, 497, 18, 0, 4096, 497, 18, 18, 4096, 189, 3,
     4096, 189, 1, 4096, 172, 0, 0, 4096, 172, 0, 18, 4096, 189, 1, 4096, 172,
     18, 0, 4096, 172, 18, 18, 4096, 189
-},
-// furniture15
-{
+};
+
+constexpr uint16_t furniture15[]{
     1542, 0, 4096, 101, 0, 0, 4096, 101, 0, 18, 4096, 101, 0, 36, 4096, 101, 0,
     54, 4096, 189, 0, 4096, 101, 18, 0, 4096, 101, 18, 18, 4096, 101, 18, 36,
     4096, 101, 18, 54, 4096, 189, 0, 4096, 101, 36, 0, 4096, 101, 36, 18, 4096,
     101, 36, 36, 4096, 101, 36, 54, 4096, 189, 2, 4096, 89, 0, 0, 4096, 89, 0,
     18, 4096, 189, 2, 4096, 89, 18, 0, 4096, 89, 18, 18, 4096, 189, 2, 4096,
     89, 36, 0, 4096, 89, 36, 18, 4096, 189
-},
-// furniture16
-{
+};
+
+constexpr uint16_t furniture16[]{
     775, 4098, 189, 4, 36864, 19, 90, 0, 8, 4096, 42, 0, 0, 4096, 42, 0, 18, 9
-},
-// furniture17
-{
+};
+
+constexpr uint16_t furniture17[]{
     775, 7, 36864, 19, 90, 0, 8, 4096, 42, 0, 0, 4096, 42, 0, 18, 2, 4098, 189,
     3
-},
-// furniture18
-{
+};
+
+constexpr uint16_t furniture18[]{
     1029, 1, 4096, 172, 0, 0, 4096, 172, 0, 18, 4096, 189, 1, 4096, 172, 18, 0,
     4096, 172, 18, 18, 4096, 189, 0, 4096, 100, 0, 0, 4096, 100, 0, 18, 4096,
     18, 0, 0, 4096, 189, 0, 4096, 100, 18, 0, 4096, 100, 18, 18, 4096, 18, 18,
     0, 4096, 189
-},
-// furniture19
-{
+};
+
+constexpr uint16_t furniture19[]{
     775, 2, 4096, 93, 0, 0, 4096, 93, 0, 18, 4096, 93, 0, 36, 4096, 189, 0,
     4096, 104, 0, 0, 4096, 104, 0, 18, 4096, 104, 0, 36, 4096, 104, 0, 54,
     4096, 104, 0, 72, 4096, 189, 0, 4096, 104, 18, 0, 4096, 104, 18, 18, 4096,
     104, 18, 36, 4096, 104, 18, 54, 4096, 104, 18, 72, 4096, 189
-},
-// furniture20
-{
+};
+
+constexpr uint16_t furniture20[]{
     1286, 2, 4096, 87, 0, 0, 4096, 87, 0, 18, 4096, 189, 2, 4096, 87, 18, 0,
     4096, 87, 18, 18, 4096, 189, 2, 4096, 87, 36, 0, 4096, 87, 36, 18, 4096,
     189, 1, 4096, 105, 0, 162, 4096, 105, 0, 180, 4096, 105, 0, 198, 4096, 189,
     1, 4096, 105, 18, 162, 4096, 105, 18, 180, 4096, 105, 18, 198, 4096, 189
-},
-// furniture21
-{
+};
+
+constexpr uint16_t furniture21[]{
     1798, 4, 4096, 189, 2, 4096, 15, 18, 0, 4096, 15, 18, 18, 4096, 189, 2,
     4096, 14, 0, 0, 4096, 14, 0, 18, 4096, 189, 2, 4096, 14, 18, 0, 4096, 14,
     18, 18, 4096, 189, 2, 4096, 14, 36, 0, 4096, 14, 36, 18, 4096, 189, 2,
     4096, 15, 0, 0, 4096, 15, 0, 18, 4096, 189, 4, 4096, 189
-},
-// furniture22
-{
+};
+
+constexpr uint16_t furniture22[]{
     1799, 4096, 189, 5, 4096, 189, 5, 4096, 189, 4096, 34, 0, 0, 4096, 34, 0,
     18, 4096, 34, 0, 36, 2, 4096, 189, 4096, 34, 18, 0, 4096, 34, 18, 18, 4096,
     34, 18, 36, 2, 4096, 189, 4096, 34, 36, 0, 4096, 34, 36, 18, 4096, 34, 36,
     36, 2, 4096, 189, 5, 4096, 189, 5
-},
-// furniture23
-{
+};
+
+constexpr uint16_t furniture23[]{
     1542, 4, 4096, 189, 4, 4096, 189, 2, 4096, 15, 0, 0, 4096, 15, 0, 18, 4096,
     189, 0, 4096, 101, 0, 0, 4096, 101, 0, 18, 4096, 101, 0, 36, 4096, 101, 0,
     54, 4096, 189, 0, 4096, 101, 18, 0, 4096, 101, 18, 18, 4096, 101, 18, 36,
     4096, 101, 18, 54, 4096, 189, 0, 4096, 101, 36, 0, 4096, 101, 36, 18, 4096,
     101, 36, 36, 4096, 101, 36, 54, 4096, 189
-},
-// furniture24
-{
+};
+
+constexpr uint16_t furniture24[]{
     1797, 1, 4096, 90, 72, 0, 4096, 90, 72, 18, 4096, 189, 1, 4096, 90, 90, 0,
     4096, 90, 90, 18, 4096, 189, 1, 4096, 90, 108, 0, 4096, 90, 108, 18, 4096,
     189, 1, 4096, 90, 126, 0, 4096, 90, 126, 18, 4096, 189, 0, 4096, 93, 0, 0,
     4096, 93, 0, 18, 4096, 93, 0, 36, 4096, 189, 3, 4096, 189, 1, 4096, 497, 0,
     0, 4096, 497, 0, 18, 4096, 189
-},
-// furniture25
-{
+};
+
+constexpr uint16_t furniture25[]{
     1797, 3, 4096, 189, 2, 4096, 18, 0, 0, 4096, 189, 2, 4096, 18, 18, 0, 4096,
     189, 1, 4096, 89, 0, 0, 4096, 89, 0, 18, 4096, 189, 1, 4096, 89, 18, 0,
     4096, 89, 18, 18, 4096, 189, 1, 4096, 89, 36, 0, 4096, 89, 36, 18, 4096,
     189, 3, 4096, 189
-},
-// furniture26
-{
+};
+
+constexpr uint16_t furniture26[]{
     773, 1, 4096, 33, 0, 0, 4096, 18, 0, 0, 4096, 189, 2, 4096, 18, 18, 0,
     4096, 189, 1, 4096, 15, 0, 0, 4096, 15, 0, 18, 4096, 189
-},
-// furniture27
-{
+};
+
+constexpr uint16_t furniture27[]{
     2310, 4, 4096, 189, 0, 4096, 101, 0, 0, 4096, 101, 0, 18, 4096, 101, 0, 36,
     4096, 101, 0, 54, 4096, 189, 0, 4096, 101, 18, 0, 4096, 101, 18, 18, 4096,
     101, 18, 36, 4096, 101, 18, 54, 4096, 189, 0, 4096, 101, 36, 0, 4096, 101,
@@ -198,39 +196,51 @@ std::vector<std::vector<uint16_t>> furnitureData{
     4096, 88, 0, 0, 4096, 88, 0, 18, 4096, 189, 2, 4096, 88, 18, 0, 4096, 88,
     18, 18, 4096, 189, 2, 4096, 88, 36, 0, 4096, 88, 36, 18, 4096, 189, 4,
     4096, 189
-},
-// furniture28
-{
+};
+
+constexpr uint16_t furniture28[]{
     1799, 5, 4096, 189, 0, 4096, 104, 0, 0, 4096, 104, 0, 18, 4096, 104, 0, 36,
     4096, 104, 0, 54, 4096, 104, 0, 72, 4096, 189, 0, 4096, 104, 18, 0, 4096,
     104, 18, 18, 4096, 104, 18, 36, 4096, 104, 18, 54, 4096, 104, 18, 72, 4096,
     189, 3, 4096, 87, 0, 0, 4096, 87, 0, 18, 4096, 189, 3, 4096, 87, 18, 0,
     4096, 87, 18, 18, 4096, 189, 3, 4096, 87, 36, 0, 4096, 87, 36, 18, 4096,
     189, 5, 4096, 189
-},
-// furniture29
-{
+};
+
+constexpr uint16_t furniture29[]{
     1542, 4, 4096, 189, 2, 4096, 14, 0, 0, 4096, 14, 0, 18, 4096, 189, 2, 4096,
     14, 18, 0, 4096, 14, 18, 18, 4096, 189, 2, 4096, 14, 36, 0, 4096, 14, 36,
     18, 4096, 189, 2, 4096, 15, 0, 0, 4096, 15, 0, 18, 4096, 189, 4, 4096, 189
-},
 };
 
-std::vector<std::vector<uint16_t>> lanternData{
-// chainLantern1
-{
+constexpr std::span<const uint16_t> furnitureData[]{
+    furniture1, furniture2, furniture3, furniture4, furniture5, furniture6,
+    furniture7, furniture8, furniture9, furniture10, furniture11, furniture12,
+    furniture13, furniture14, furniture15, furniture16, furniture17,
+    furniture18, furniture19, furniture20, furniture21, furniture22,
+    furniture23, furniture24, furniture25, furniture26, furniture27,
+    furniture28, furniture29
+};
+
+constexpr uint16_t chainLantern1[]{
     263, 4099, 214, 4096, 19, 90, 162, 4096, 42, 0, 144, 4096, 42, 0, 162
-},
-// chainLantern2
-{
+};
+
+constexpr uint16_t chainLantern2[]{
     263, 4099, 214, 4096, 19, 90, 162, 4096, 42, 0, 216, 4096, 42, 0, 234
-},
-// chainLantern3
-{
+};
+
+constexpr uint16_t chainLantern3[]{
     263, 4099, 214, 4096, 19, 90, 162, 4096, 42, 18, 900, 4096, 42, 18, 918
-},
+};
+
+constexpr std::span<const uint16_t> lanternData[]{
+    chainLantern1, chainLantern2, chainLantern3
 };
 // clang-format on
+
+TileBufferCache furnitureCache{furnitureData};
+TileBufferCache lanternCache{lanternData};
 } // namespace
 
 namespace Data
@@ -508,7 +518,7 @@ bool convertFurniture(Tile &tile, Variant furnitureSet)
 TileBuffer
 getFurniture(int id, Variant furnitureSet, const FramedBitset &framedTiles)
 {
-    TileBuffer data{furnitureData[id].data(), framedTiles};
+    TileBuffer data = furnitureCache.get(id, framedTiles);
     for (int i = 0; i < data.getWidth(); ++i) {
         for (int j = 0; j < data.getHeight(); ++j) {
             Tile &tile = data.getTile(i, j);
@@ -530,11 +540,11 @@ getChainLantern(::Variant lanternStyle, const FramedBitset &framedTiles)
 {
     switch (lanternStyle) {
     case ::Variant::alchemy:
-        return {lanternData[0].data(), framedTiles};
+        return lanternCache.get(0, framedTiles);
     case ::Variant::oilRagSconce:
-        return {lanternData[1].data(), framedTiles};
+        return lanternCache.get(1, framedTiles);
     case ::Variant::bone:
-        return {lanternData[2].data(), framedTiles};
+        return lanternCache.get(2, framedTiles);
     default:
         return {};
     }
@@ -3,9 +3,7 @@
 namespace
 {
 // clang-format off
-std::vector<std::vector<uint16_t>> homeData{
-// house1
-{
+constexpr uint16_t house1[]{
     8477, 4110, 189, 20480, 189, 1, 4109, 189, 19, 36864, 19, 144, 0, 24, 4097,
     0, 3, 4097, 189, 18, 36864, 19, 144, 0, 24, 0, 4098, 0, 2, 4097, 189, 17,
     36864, 19, 144, 0, 24, 1, 4098, 0, 2, 4097, 189, 16, 36864, 19, 144, 0, 24,
@@ -48,9 +46,9 @@ std::vector<std::vector<uint16_t>> homeData{
     16, 2, 4099, 0, 1, 4097, 189, 17, 36864, 19, 180, 0, 16, 1, 4098, 0, 2,
     4097, 189, 18, 36864, 19, 180, 0, 16, 0, 4098, 0, 2, 4097, 189, 19, 36864,
     19, 180, 0, 16, 4097, 0, 3, 4125, 189
-},
-// house2
-{
+};
+
+constexpr uint16_t house2[]{
     10784, 4113, 189, 20480, 189, 1, 4109, 189, 22, 36864, 19, 144, 0, 24,
     4097, 0, 3, 4097, 189, 21, 36864, 19, 144, 0, 24, 0, 4098, 0, 2, 4097, 189,
     20, 36864, 19, 144, 0, 24, 1, 4098, 0, 2, 4097, 189, 19, 36864, 19, 144, 0,
@@ -111,9 +109,9 @@ std::vector<std::vector<uint16_t>> homeData{
     4099, 0, 1, 4097, 189, 20, 36864, 19, 180, 0, 16, 1, 4098, 0, 2, 4097, 189,
     21, 36864, 19, 180, 0, 16, 0, 4098, 0, 2, 4097, 189, 22, 36864, 19, 180, 0,
     16, 4097, 0, 3, 4128, 189
-},
-// house3
-{
+};
+
+constexpr uint16_t house3[]{
     9502, 4111, 189, 20480, 189, 1, 4109, 189, 20, 36864, 19, 144, 0, 24, 4097,
     0, 3, 4097, 189, 19, 36864, 19, 144, 0, 24, 0, 4098, 0, 2, 4097, 189, 18,
     36864, 19, 144, 0, 24, 1, 4098, 0, 2, 4097, 189, 17, 36864, 19, 144, 0, 24,
@@ -167,9 +165,9 @@ std::vector<std::vector<uint16_t>> homeData{
     4097, 189, 18, 36864, 19, 180, 0, 16, 1, 4098, 0, 2, 4097, 189, 19, 36864,
     19, 180, 0, 16, 0, 4098, 0, 2, 4097, 189, 20, 36864, 19, 180, 0, 16, 4097,
     0, 3, 4126, 189
-},
-// house4
-{
+};
+
+constexpr uint16_t house4[]{
     8990, 4111, 189, 20480, 189, 1, 4109, 189, 20, 36864, 19, 144, 0, 24, 4097,
     0, 3, 4097, 189, 19, 36864, 19, 144, 0, 24, 0, 4098, 0, 2, 4097, 189, 18,
     36864, 19, 144, 0, 24, 1, 4098, 0, 2, 4097, 189, 17, 36864, 19, 144, 0, 24,
@@ -222,9 +220,9 @@ std::vector<std::vector<uint16_t>> homeData{
     180, 0, 16, 2, 4099, 0, 1, 4097, 189, 18, 36864, 19, 180, 0, 16, 1, 4098,
     0, 2, 4097, 189, 19, 36864, 19, 180, 0, 16, 0, 4098, 0, 2, 4097, 189, 20,
     36864, 19, 180, 0, 16, 4097, 0, 3, 4126, 189
-},
-// house5
-{
+};
+
+constexpr uint16_t house5[]{
     8988, 4109, 189, 20480, 189, 1, 4109, 189, 18, 36864, 19, 144, 0, 24, 4097,
     0, 3, 4097, 189, 17, 36864, 19, 144, 0, 24, 0, 4098, 0, 2, 4097, 189, 16,
     36864, 19, 144, 0, 24, 1, 4098, 0, 2, 4097, 189, 15, 36864, 19, 144, 0, 24,
@@ -274,9 +272,9 @@ std::vector<std::vector<uint16_t>> homeData{
     189, 16, 36864, 19, 180, 0, 16, 1, 4098, 0, 2, 4097, 189, 17, 36864, 19,
     180, 0, 16, 0, 4098, 0, 2, 4097, 189, 18, 36864, 19, 180, 0, 16, 4097, 0,
     3, 4124, 189
-},
-// house6
-{
+};
+
+constexpr uint16_t house6[]{
     8731, 4108, 189, 20480, 189, 1, 4109, 189, 17, 36864, 19, 144, 0, 24, 4097,
     0, 3, 4097, 189, 16, 36864, 19, 144, 0, 24, 0, 4098, 0, 2, 4097, 189, 15,
     36864, 19, 144, 0, 24, 1, 4098, 0, 2, 4097, 189, 14, 36864, 19, 144, 0, 24,
@@ -319,9 +317,14 @@ std::vector<std::vector<uint16_t>> homeData{
     4097, 189, 15, 36864, 19, 180, 0, 16, 1, 4098, 0, 2, 4097, 189, 16, 36864,
     19, 180, 0, 16, 0, 4098, 0, 2, 4097, 189, 17, 36864, 19, 180, 0, 16, 4097,
     0, 3, 4123, 189
-},
+};
+
+constexpr std::span<const uint16_t> homeData[]{
+    house1, house2, house3, house4, house5, house6
 };
 // clang-format on
+
+TileBufferCache homeCache{homeData};
 } // namespace
 
 namespace Data
@@ -329,7 +332,7 @@ namespace Data
 
 TileBuffer getHome(int homeId, const FramedBitset &framedTiles)
 {
-    return {homeData[homeId].data(), framedTiles};
+    return homeCache.get(homeId, framedTiles);
 }
 
 } // namespace Data
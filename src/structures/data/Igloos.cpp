@@ -3,9 +3,7 @@
 namespace
 {
 // clang-format off
-std::vector<std::vector<uint16_t>> iglooData{
-// igloo1
-{
+constexpr uint16_t igloo1[]{
     11290, 4107, 189, 20485, 189, 1, 4104, 189, 11, 4109, 189, 12, 4096, 189,
     4097, 147, 4105, 189, 12, 4099, 147, 4104, 189, 11, 53248, 152, 26, 24,
     4099, 147, 4104, 189, 9, 53248, 152, 26, 24, 20482, 152, 26, 4099, 147,
@@ -68,9 +66,9 @@ std::vector<std::vector<uint16_t>> iglooData{
     189, 9, 4096, 93, 0, 1080, 4096, 93, 0, 1098, 4096, 93, 0, 1116, 4101, 147,
     4102, 189, 12, 4096, 189, 4099, 147, 4103, 189, 11, 4098, 189, 4097, 147,
     4104, 189, 10, 4119, 189, 20487, 189, 1, 4103, 189
-},
-// igloo2
-{
+};
+
+constexpr uint16_t igloo2[]{
     10011, 4110, 189, 20484, 189, 1, 4103, 189, 14, 4098, 189, 4098, 147, 4101,
     189, 15, 4096, 189, 4100, 147, 4100, 189, 16, 4101, 147, 4099, 189, 16,
     20480, 152, 26, 4102, 147, 4097, 189, 14, 24577, 45, 6656, 20481, 152, 26,
@@ -143,9 +141,9 @@ std::vector<std::vector<uint16_t>> iglooData{
     147, 20483, 152, 26, 4105, 147, 4101, 189, 12, 4103, 147, 4101, 189, 14,
     4097, 189, 4099, 147, 4101, 189, 14, 4098, 189, 4097, 147, 4116, 189,
     20484, 189, 1, 4102, 189
-},
-// igloo3
-{
+};
+
+constexpr uint16_t igloo3[]{
     8467, 4106, 189, 20483, 189, 1, 4100, 189, 10, 4103, 189, 11, 4102, 189, 9,
     20481, 177, 26, 4098, 147, 4099, 189, 7, 36864, 147, 8, 20481, 177, 26,
     28672, 177, 47, 6682, 4099, 147, 4098, 189, 6, 36864, 147, 8, 20481, 177,
@@ -192,9 +190,9 @@ std::vector<std::vector<uint16_t>> iglooData{
     7, 20480, 177, 26, 2, 4099, 147, 4098, 189, 11, 4098, 147, 4099, 189, 11,
     4096, 189, 4097, 147, 4099, 189, 10, 4098, 189, 4096, 147, 4109, 189,
     20484, 189, 1, 4098, 189
-},
-// igloo4
-{
+};
+
+constexpr uint16_t igloo4[]{
     9495, 4104, 189, 20484, 189, 1, 4105, 189, 8, 4109, 189, 9, 4096, 189,
     4098, 147, 4104, 189, 9, 4100, 147, 4103, 189, 9, 4102, 147, 4101, 189, 8,
     20485, 151, 26, 4098, 147, 4100, 189, 8, 20485, 151, 26, 4099, 147, 4099,
@@ -254,9 +252,9 @@ std::vector<std::vector<uint16_t>> iglooData{
     151, 26, 4100, 147, 4099, 189, 7, 4097, 147, 20483, 151, 26, 4098, 147,
     4101, 189, 7, 4104, 147, 4101, 189, 8, 4096, 189, 4101, 147, 4102, 189, 7,
     4098, 189, 4098, 147, 4111, 189, 20484, 189, 1, 4105, 189
-},
-// igloo5
-{
+};
+
+constexpr uint16_t igloo5[]{
     9494, 4102, 189, 20485, 189, 1, 4105, 189, 6, 4099, 189, 4098, 147, 4103,
     189, 8, 4096, 189, 4100, 147, 4102, 189, 9, 4101, 147, 4101, 189, 9, 36864,
     147, 8, 4100, 147, 4101, 189, 9, 36864, 147, 8, 4101, 147, 4100, 189, 9,
@@ -312,9 +310,9 @@ std::vector<std::vector<uint16_t>> iglooData{
     20480, 273, 26, 4098, 147, 4101, 189, 8, 36864, 147, 8, 4101, 147, 4101,
     189, 8, 4101, 147, 4102, 189, 8, 4098, 147, 4105, 189, 7, 4109, 189, 7,
     4116, 189, 20483, 189, 1, 4105, 189
-},
-// igloo6
-{
+};
+
+constexpr uint16_t igloo6[]{
     11547, 4110, 189, 20485, 189, 1, 4102, 189, 14, 4099, 189, 4096, 147, 4100,
     161, 4097, 189, 15, 4097, 189, 4097, 147, 4099, 161, 4096, 147, 4097, 189,
     14, 4097, 189, 4098, 147, 4097, 161, 4098, 147, 4097, 189, 10, 36864, 147,
@@ -415,9 +413,9 @@ std::vector<std::vector<uint16_t>> iglooData{
     274, 26, 32, 1, 4099, 147, 4100, 161, 4096, 147, 4097, 189, 13, 4097, 189,
     4098, 147, 4099, 161, 4097, 147, 4097, 189, 11, 4100, 189, 4098, 147, 4097,
     161, 4098, 147, 4108, 189, 20486, 189, 1, 4103, 189
-},
-// igloo7
-{
+};
+
+constexpr uint16_t igloo7[]{
     8724, 4103, 189, 20485, 189, 1, 4102, 189, 7, 4099, 189, 4101, 147, 4097,
     189, 7, 4097, 189, 4103, 147, 4097, 189, 7, 4096, 189, 4104, 147, 4097,
     189, 8, 4101, 147, 4096, 161, 4097, 147, 4097, 189, 8, 24576, 34, 6656,
@@ -478,9 +476,9 @@ std::vector<std::vector<uint16_t>> iglooData{
     147, 4098, 161, 4096, 147, 4097, 189, 9, 4096, 189, 4098, 147, 4097, 161,
     4097, 147, 4097, 189, 8, 4098, 189, 4096, 147, 4098, 161, 4097, 147, 4105,
     189, 20484, 189, 1, 4101, 189
-},
-// igloo8
-{
+};
+
+constexpr uint16_t igloo8[]{
     14876, 4107, 189, 20492, 189, 1, 4122, 189, 4098, 147, 4102, 189, 7, 4101,
     189, 4102, 147, 4101, 189, 9, 4097, 189, 4105, 147, 4099, 189, 12, 4096,
     189, 4105, 147, 4098, 189, 12, 4096, 215, 162, 0, 4096, 215, 162, 18, 4105,
@@ -559,9 +557,9 @@ std::vector<std::vector<uint16_t>> iglooData{
     4096, 189, 4103, 147, 4097, 189, 15, 4097, 189, 4103, 147, 4097, 189, 15,
     4098, 189, 4102, 147, 4097, 189, 14, 4100, 189, 4101, 147, 4097, 189, 10,
     4104, 189, 4101, 147, 4112, 189, 20487, 189, 1, 4099, 189
-},
-// igloo9
-{
+};
+
+constexpr uint16_t igloo9[]{
     13855, 4112, 189, 20487, 189, 1, 4102, 189, 16, 4109, 189, 17, 4108, 189,
     18, 4098, 189, 4097, 147, 4102, 189, 19, 4096, 189, 4098, 147, 4102, 189,
     19, 4096, 189, 4098, 147, 4102, 189, 19, 4100, 147, 4101, 189, 19, 4100,
@@ -654,9 +652,9 @@ std::vector<std::vector<uint16_t>> iglooData{
     20481, 274, 26, 4098, 147, 4101, 189, 19, 4099, 147, 4102, 189, 19, 4096,
     189, 4097, 147, 4103, 189, 18, 4098, 189, 4096, 147, 4121, 189, 20484, 189,
     1, 4102, 189
-},
-// igloo10
-{
+};
+
+constexpr uint16_t igloo10[]{
     12064, 4113, 189, 20484, 189, 1, 4105, 189, 17, 4098, 189, 4097, 147, 4104,
     189, 18, 4096, 189, 4098, 147, 4104, 189, 18, 4099, 147, 4104, 189, 15,
     20485, 274, 26, 4098, 147, 4102, 189, 12, 36864, 147, 8, 20488, 274, 26,
@@ -729,9 +727,15 @@ std::vector<std::vector<uint16_t>> iglooData{
     20489, 274, 26, 4097, 147, 4100, 189, 18, 4102, 147, 4101, 189, 18, 4096,
     189, 4101, 147, 4101, 189, 17, 4098, 189, 4098, 147, 4103, 189, 16, 4100,
     189, 4096, 147, 4120, 189, 20486, 189, 1, 4103, 189
-},
+};
+
+constexpr std::span<const uint16_t> iglooData[]{
+    igloo1, igloo2, igloo3, igloo4, igloo5, igloo6, igloo7, igloo8, igloo9,
+    igloo10
 };
 // clang-format on
+
+TileBufferCache iglooCache{iglooData};
 } // namespace
 
 namespace Data
@@ -739,7 +743,7 @@ namespace Data
 
 TileBuffer getIgloo(int iglooId, const FramedBitset &framedTiles)
 {
-    return {iglooData[iglooId].data(), framedTiles};
+    return iglooCache.get(iglooId, framedTiles);
 }
 
 } // namespace Data
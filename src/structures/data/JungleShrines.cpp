@@ -3,9 +3,7 @@
 namespace
 {
 // clang-format off
-std::vector<std::vector<uint16_t>> shrineData{
-// jungleShrine1
-{
+constexpr uint16_t jungleShrine1[]{
     3356, 4112, 189, 20480, 189, 1, 4113, 189, 8, 4096, 59, 4107, 189, 14,
     4096, 59, 4107, 189, 2, 4096, 156, 10, 4096, 59, 4106, 189, 2, 36864, 156,
     8, 4096, 156, 36864, 156, 40, 1, 4103, 120, 4105, 59, 4098, 189, 2, 36864,
@@ -21,17 +19,17 @@ std::vector<std::vector<uint16_t>> shrineData{
     36864, 156, 32, 2, 4100, 120, 36866, 120, 64, 36864, 59, 64, 4104, 59,
     4097, 189, 2, 36864, 156, 40, 11, 4096, 59, 4107, 189, 14, 4096, 59, 4109,
     189, 10, 4097, 189, 4096, 59, 4119, 189, 20483, 189, 1, 4105, 189
-},
-// jungleShrine2
-{
+};
+
+constexpr uint16_t jungleShrine2[]{
     2056, 4104, 189, 1, 8193, 315, 1, 4097, 189, 0, 8195, 315, 0, 4097, 189,
     8192, 315, 12288, 21, 360, 0, 315, 12288, 21, 360, 18, 315, 12288, 19, 36,
     792, 315, 8193, 315, 4097, 189, 8192, 315, 12288, 21, 378, 0, 315, 12288,
     21, 378, 18, 315, 12288, 19, 18, 792, 315, 8193, 315, 4097, 189, 0, 8195,
     315, 0, 4097, 189, 1, 8193, 315, 1, 4104, 189
-},
-// jungleShrine3
-{
+};
+
+constexpr uint16_t jungleShrine3[]{
     2569, 4102, 189, 20481, 189, 1, 4096, 189, 1, 8194, 73, 8192, 60, 4096, 59,
     4097, 189, 8194, 73, 8194, 60, 4096, 59, 4097, 189, 8192, 73, 8196, 60,
     4096, 59, 4097, 189, 8193, 60, 12288, 21, 288, 0, 60, 12288, 21, 288, 18,
@@ -40,9 +38,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     4096, 59, 4097, 189, 8192, 73, 8196, 60, 4096, 59, 4097, 189, 0, 8193, 73,
     8194, 60, 4096, 59, 4097, 189, 1, 8194, 73, 8192, 60, 4096, 59, 4103, 189,
     20481, 189, 1
-},
-// jungleShrine4
-{
+};
+
+constexpr uint16_t jungleShrine4[]{
     2569, 4101, 189, 20481, 189, 1, 4097, 189, 4, 4096, 383, 4096, 59, 4097,
     189, 3, 4096, 158, 4096, 383, 4096, 59, 4097, 189, 2, 4096, 383, 4096, 158,
     4096, 383, 4096, 59, 4097, 189, 4096, 21, 288, 0, 4096, 21, 288, 18, 4096,
@@ -51,9 +49,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     4097, 189, 2, 4096, 383, 4096, 158, 4096, 383, 4096, 59, 4097, 189, 3,
     4096, 158, 4096, 383, 4096, 59, 4097, 189, 4, 4096, 383, 4096, 59, 4102,
     189, 20481, 189, 1, 4096, 189
-},
-// jungleShrine5
-{
+};
+
+constexpr uint16_t jungleShrine5[]{
     2569, 4098, 189, 20484, 189, 1, 4101, 189, 4098, 59, 4098, 189, 4101, 59,
     4097, 189, 4097, 59, 1, 4096, 4, 0, 462, 4096, 119, 4096, 59, 4097, 189,
     4096, 59, 1, 4096, 21, 360, 0, 4096, 21, 360, 18, 4096, 120, 4096, 59,
@@ -61,9 +59,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     4096, 59, 4097, 189, 4096, 59, 4096, 4, 0, 462, 4096, 119, 4096, 120, 4096,
     119, 4096, 120, 4096, 59, 4097, 189, 4102, 59, 4097, 189, 4102, 59, 4097,
     189, 20486, 189, 1, 4096, 189
-},
-// jungleShrine6
-{
+};
+
+constexpr uint16_t jungleShrine6[]{
     4624, 4097, 189, 20480, 189, 1, 4103, 189, 20483, 189, 1, 4106, 189, 1,
     4108, 189, 4, 4104, 189, 6, 4096, 59, 4098, 189, 4100, 120, 36870, 120,
     2048, 4096, 59, 4098, 189, 4096, 120, 8194, 24, 4096, 120, 6, 4096, 59,
@@ -76,9 +74,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     189, 4096, 19, 72, 36, 8194, 24, 4096, 120, 6, 4096, 59, 4098, 189, 4100,
     120, 36870, 120, 2048, 4096, 59, 4103, 189, 6, 4096, 59, 4104, 189, 4,
     4106, 189, 1, 4103, 189, 20480, 189, 1, 4102, 189, 20484, 189, 1, 4096, 189
-},
-// jungleShrine7
-{
+};
+
+constexpr uint16_t jungleShrine7[]{
     3339, 4102, 189, 20483, 189, 1, 4096, 189, 6, 4097, 59, 4097, 189, 6, 4097,
     59, 4097, 189, 2, 4100, 383, 4096, 59, 4097, 189, 0, 8192, 73, 4096, 383,
     12292, 383, 78, 4096, 59, 4097, 189, 0, 8193, 73, 8194, 78, 8192, 73, 8192,
@@ -87,17 +85,17 @@ std::vector<std::vector<uint16_t>> shrineData{
     21, 378, 0, 78, 12288, 21, 378, 18, 78, 4096, 59, 4097, 189, 0, 8192, 73,
     12293, 383, 78, 4096, 59, 4097, 189, 1, 4101, 383, 4096, 59, 4097, 189, 6,
     4097, 59, 4097, 189, 7, 4096, 59, 4103, 189, 20483, 189, 1
-},
-// jungleShrine8
-{
+};
+
+constexpr uint16_t jungleShrine8[]{
     2566, 4099, 189, 20481, 189, 1, 4099, 189, 4096, 383, 4100, 189, 4096, 383,
     4099, 189, 4097, 383, 4097, 189, 4096, 21, 360, 0, 4096, 21, 360, 18, 4097,
     383, 4097, 189, 4096, 21, 378, 0, 4096, 21, 378, 18, 4097, 383, 4099, 189,
     4097, 383, 4100, 189, 4096, 383, 4100, 189, 4096, 383, 4100, 189, 20481,
     189, 1
-},
-// jungleShrine9
-{
+};
+
+constexpr uint16_t jungleShrine9[]{
     2571, 4104, 189, 20481, 189, 1, 4097, 189, 4099, 226, 4096, 10, 36, 756,
     4096, 10, 0, 774, 4096, 10, 36, 792, 4096, 226, 4098, 189, 4096, 226, 8197,
     112, 4096, 226, 4097, 189, 4097, 226, 12288, 42, 0, 684, 112, 12288, 42, 0,
@@ -108,9 +106,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     112, 4096, 226, 4098, 189, 4096, 226, 8197, 112, 4096, 226, 4098, 189,
     4099, 226, 4096, 10, 0, 756, 4096, 10, 0, 774, 4096, 10, 0, 792, 4096, 226,
     4105, 189, 20481, 189, 1
-},
-// jungleShrine10
-{
+};
+
+constexpr uint16_t jungleShrine10[]{
     3592, 4097, 189, 20485, 189, 1, 4096, 189, 4100, 158, 4096, 59, 4097, 189,
     4096, 158, 12288, 4, 22, 66, 78, 8192, 78, 12288, 21, 288, 0, 78, 12288,
     21, 288, 18, 78, 4096, 59, 4097, 189, 4096, 158, 8193, 78, 12288, 21, 306,
@@ -119,9 +117,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     2, 4096, 59, 4099, 189, 2, 4096, 59, 4098, 189, 3, 4096, 59, 4098, 189, 3,
     4096, 59, 4097, 189, 4, 4098, 189, 3, 4099, 189, 0, 4101, 189, 20486, 189,
     1, 4096, 189
-},
-// jungleShrine11
-{
+};
+
+constexpr uint16_t jungleShrine11[]{
     3849, 20487, 189, 1, 4106, 189, 1, 4102, 189, 4, 4099, 189, 4, 4100, 189,
     4, 4099, 189, 4, 4096, 59, 4099, 189, 3, 4096, 59, 4098, 189, 4097, 120, 2,
     4096, 59, 4098, 189, 4096, 120, 12288, 59, 24, 8194, 24, 4096, 59, 4098,
@@ -130,9 +128,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     4096, 59, 4098, 189, 4096, 120, 4096, 59, 12288, 59, 24, 12288, 21, 306, 0,
     24, 12288, 21, 306, 18, 24, 4096, 59, 4098, 189, 4100, 120, 4096, 59, 4099,
     189, 20485, 189, 1
-},
-// jungleShrine12
-{
+};
+
+constexpr uint16_t jungleShrine12[]{
     4880, 4106, 189, 20483, 189, 1, 4097, 189, 0, 4096, 189, 0, 4105, 189,
     4096, 59, 4097, 189, 11, 4096, 189, 4096, 59, 4097, 189, 11, 4096, 189,
     4096, 59, 4097, 189, 12, 4096, 59, 4097, 189, 12, 4096, 59, 4097, 189, 3,
@@ -145,9 +143,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     189, 3, 4104, 120, 4096, 59, 4097, 189, 3, 4104, 120, 4096, 59, 4097, 189,
     12, 4096, 59, 4097, 189, 12, 4096, 59, 4097, 189, 10, 4097, 189, 4096, 59,
     4099, 189, 5, 4100, 189, 4096, 59, 4104, 189, 20486, 189, 1, 4096, 189
-},
-// jungleShrine13
-{
+};
+
+constexpr uint16_t jungleShrine13[]{
     4621, 4104, 189, 20482, 189, 1, 4097, 189, 9, 4096, 59, 4097, 189, 8, 4096,
     120, 4096, 59, 4097, 189, 7, 4097, 120, 4096, 59, 4097, 189, 6, 4098, 120,
     4096, 59, 4097, 189, 5, 4099, 120, 4096, 59, 4097, 189, 4, 4100, 120, 4096,
@@ -159,9 +157,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     4097, 189, 5, 4099, 120, 4096, 59, 4097, 189, 6, 4098, 120, 4096, 59, 4097,
     189, 7, 4097, 120, 4096, 59, 4097, 189, 8, 4096, 120, 4096, 59, 4097, 189,
     9, 4096, 59, 4105, 189, 20482, 189, 1, 4096, 189
-},
-// jungleShrine14
-{
+};
+
+constexpr uint16_t jungleShrine14[]{
     2571, 4102, 189, 20481, 189, 1, 4098, 189, 4098, 158, 36866, 158, 2048,
     4098, 59, 4097, 189, 4097, 158, 36867, 158, 2048, 4098, 59, 4097, 189,
     4096, 158, 36868, 158, 2048, 4096, 59, 4097, 158, 4097, 189, 4096, 158,
@@ -170,27 +168,27 @@ std::vector<std::vector<uint16_t>> shrineData{
     306, 18, 42, 4096, 158, 4097, 189, 4096, 158, 36868, 158, 2048, 4096, 59,
     4097, 158, 4097, 189, 4097, 158, 36867, 158, 2048, 4098, 59, 4097, 189,
     4098, 158, 36866, 158, 2048, 4098, 59, 4103, 189, 20481, 189, 1, 4097, 189
-},
-// jungleShrine15
-{
+};
+
+constexpr uint16_t jungleShrine15[]{
     1798, 20483, 189, 1, 4098, 189, 36864, 383, 8, 4097, 383, 4096, 59, 4097,
     189, 4096, 383, 12288, 21, 360, 0, 42, 12288, 21, 360, 18, 42, 4096, 59,
     4097, 189, 4096, 383, 12288, 21, 378, 0, 42, 12288, 21, 378, 18, 42, 4096,
     59, 4097, 189, 4096, 383, 12288, 4, 44, 66, 42, 8192, 42, 4096, 59, 4097,
     189, 36864, 383, 16, 4097, 383, 4096, 59, 4096, 189, 20483, 189, 1, 4097,
     189
-},
-// jungleShrine16
-{
+};
+
+constexpr uint16_t jungleShrine16[]{
     1798, 20483, 189, 1, 4098, 189, 36864, 120, 24, 4097, 120, 4096, 59, 4097,
     189, 4096, 120, 12288, 4, 22, 66, 78, 8192, 78, 4096, 59, 4097, 189, 4096,
     120, 12288, 21, 288, 0, 78, 12288, 21, 288, 18, 78, 4096, 59, 4097, 189,
     4096, 120, 12288, 21, 306, 0, 78, 12288, 21, 306, 18, 78, 4096, 59, 4097,
     189, 36864, 120, 8, 4097, 120, 4096, 59, 4096, 189, 20483, 189, 1, 4097,
     189
-},
-// jungleShrine17
-{
+};
+
+constexpr uint16_t jungleShrine17[]{
     2567, 4098, 189, 20482, 189, 1, 4097, 189, 0, 4096, 119, 4098, 59, 4097,
     189, 4096, 215, 702, 0, 12288, 215, 702, 18, 23, 4098, 59, 4097, 189, 4096,
     215, 720, 0, 12288, 215, 720, 18, 23, 4098, 59, 4097, 189, 4096, 215, 738,
@@ -198,9 +196,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     4097, 189, 4096, 21, 288, 0, 4096, 21, 288, 18, 4096, 119, 4097, 59, 4097,
     189, 4096, 21, 306, 0, 4096, 21, 306, 18, 4096, 119, 4097, 59, 4097, 189,
     1, 4096, 119, 4097, 59, 4099, 189, 20482, 189, 1, 4096, 189
-},
-// jungleShrine18
-{
+};
+
+constexpr uint16_t jungleShrine18[]{
     2311, 4098, 189, 20482, 189, 1, 4097, 189, 1, 4097, 120, 4096, 59, 4097,
     189, 4096, 21, 360, 0, 4096, 21, 360, 18, 4097, 120, 4096, 59, 4097, 189,
     4096, 21, 378, 0, 4096, 21, 378, 18, 4097, 120, 4096, 59, 4097, 189, 1,
@@ -208,9 +206,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     4097, 120, 4096, 59, 4097, 189, 4096, 215, 720, 0, 4096, 215, 720, 18,
     4097, 120, 4096, 59, 4097, 189, 4096, 215, 738, 0, 4096, 215, 738, 18,
     4097, 120, 4096, 59, 4099, 189, 20482, 189, 1, 4096, 189
-},
-// jungleShrine19
-{
+};
+
+constexpr uint16_t jungleShrine19[]{
     3849, 4097, 189, 20484, 189, 1, 4098, 189, 2, 4101, 189, 4, 4099, 189, 5,
     4098, 189, 5, 4096, 59, 4097, 189, 5, 4096, 59, 4097, 189, 4098, 383, 4096,
     10, 36, 378, 4096, 10, 0, 396, 4096, 10, 36, 414, 4096, 59, 4097, 189,
@@ -220,9 +218,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     59, 4097, 189, 4096, 383, 12288, 21, 306, 0, 42, 12288, 21, 306, 18, 42,
     12288, 19, 72, 36, 42, 8193, 42, 4096, 59, 4097, 189, 4099, 383, 4098, 59,
     4102, 189, 4097, 59, 4096, 189, 20486, 189, 1, 4097, 189
-},
-// jungleShrine20
-{
+};
+
+constexpr uint16_t jungleShrine20[]{
     5646, 4106, 189, 20482, 189, 1, 4096, 189, 10, 4096, 59, 4097, 189, 9,
     4096, 120, 4096, 59, 4097, 189, 8, 36864, 120, 2056, 4096, 120, 4096, 59,
     4097, 189, 7, 4096, 120, 36864, 120, 2048, 4096, 120, 4096, 59, 4097, 189,
@@ -248,9 +246,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     189, 7, 4096, 120, 36864, 120, 2048, 4096, 120, 4096, 59, 4097, 189, 8,
     36864, 120, 2056, 4096, 120, 4096, 59, 4097, 189, 9, 4096, 120, 4096, 59,
     4097, 189, 10, 4096, 59, 4107, 189, 20482, 189, 1
-},
-// jungleShrine21
-{
+};
+
+constexpr uint16_t jungleShrine21[]{
     3592, 4097, 189, 20482, 189, 1, 4101, 189, 12290, 59, 24, 4096, 59, 4099,
     189, 12290, 59, 24, 4096, 59, 4098, 189, 12291, 59, 24, 4096, 59, 4098,
     189, 12291, 59, 24, 4096, 59, 4097, 189, 12292, 59, 24, 4096, 59, 4097,
@@ -260,9 +258,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     4096, 59, 4098, 189, 12291, 59, 24, 4096, 59, 4099, 189, 12290, 59, 24,
     4096, 59, 4099, 189, 12290, 59, 24, 4096, 59, 4098, 189, 20482, 189, 1,
     4098, 189
-},
-// jungleShrine22
-{
+};
+
+constexpr uint16_t jungleShrine22[]{
     5388, 4097, 189, 20488, 189, 1, 4102, 189, 3, 4096, 59, 4102, 189, 3, 4096,
     59, 4097, 189, 4100, 383, 4096, 10, 36, 108, 4096, 10, 0, 126, 4096, 10, 0,
     144, 4096, 383, 4096, 59, 4097, 189, 4096, 383, 8192, 42, 12288, 4, 22,
@@ -280,9 +278,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     189, 8, 4096, 59, 4097, 189, 7, 4096, 189, 4096, 59, 4097, 189, 6, 4097,
     189, 4096, 59, 4097, 189, 5, 4098, 189, 4096, 59, 4097, 189, 1, 4102, 189,
     4096, 59, 4106, 189, 4096, 59, 4098, 189, 20488, 189, 1, 4096, 189
-},
-// jungleShrine23
-{
+};
+
+constexpr uint16_t jungleShrine23[]{
     6677, 4109, 189, 20486, 189, 1, 4108, 189, 1, 4114, 189, 2, 4112, 189, 4,
     4097, 189, 4096, 59, 4108, 189, 6, 4096, 59, 4107, 189, 7, 4096, 59, 4097,
     189, 4110, 158, 36866, 158, 3136, 4096, 59, 4097, 189, 4110, 158, 36866,
@@ -304,9 +302,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     36866, 158, 3136, 4096, 59, 4107, 189, 7, 4096, 59, 4108, 189, 6, 4096, 59,
     4109, 189, 4, 4096, 189, 4096, 59, 4110, 189, 1, 4114, 189, 1, 4114, 189,
     0, 4115, 189, 20486, 189, 1
-},
-// jungleShrine24
-{
+};
+
+constexpr uint16_t jungleShrine24[]{
     3081, 4102, 189, 20481, 189, 1, 4096, 189, 4098, 119, 2, 4096, 119, 4097,
     189, 4096, 119, 8192, 23, 12288, 4, 22, 462, 23, 8194, 23, 4096, 119, 4097,
     189, 4096, 119, 8196, 23, 4096, 119, 4097, 189, 4096, 119, 8196, 23, 4096,
@@ -317,17 +315,17 @@ std::vector<std::vector<uint16_t>> shrineData{
     189, 4096, 119, 8196, 23, 4096, 119, 4097, 189, 4096, 119, 8192, 23, 12288,
     4, 44, 462, 23, 8194, 23, 4096, 119, 4097, 189, 4098, 119, 2, 4096, 119,
     4103, 189, 20481, 189, 1
-},
-// jungleShrine25
-{
+};
+
+constexpr uint16_t jungleShrine25[]{
     2567, 4099, 189, 20482, 189, 1, 4100, 189, 4096, 119, 4100, 189, 4097, 119,
     4099, 189, 4098, 119, 4097, 189, 4096, 21, 360, 0, 4096, 21, 360, 18, 4098,
     119, 4097, 189, 4096, 21, 378, 0, 4096, 21, 378, 18, 4098, 119, 4099, 189,
     4098, 119, 4100, 189, 4097, 119, 4101, 189, 4096, 119, 4100, 189, 20482,
     189, 1
-},
-// jungleShrine26
-{
+};
+
+constexpr uint16_t jungleShrine26[]{
     3080, 4100, 189, 20482, 189, 1, 4096, 189, 4, 4096, 120, 4097, 189, 3,
     8192, 23, 4096, 120, 4097, 189, 1, 12288, 4, 0, 462, 23, 8192, 23, 12288,
     120, 23, 4096, 120, 4097, 189, 0, 8193, 23, 12288, 119, 23, 4097, 120,
@@ -337,9 +335,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     189, 1, 12288, 4, 0, 462, 23, 8192, 23, 12288, 120, 23, 4096, 120, 4097,
     189, 3, 8192, 23, 4096, 120, 4097, 189, 4, 4096, 120, 4101, 189, 20482,
     189, 1
-},
-// jungleShrine27
-{
+};
+
+constexpr uint16_t jungleShrine27[]{
     2571, 4102, 189, 20482, 189, 1, 4098, 189, 36864, 563, 24, 4102, 563, 4098,
     189, 4103, 563, 4098, 189, 4096, 563, 0, 8196, 313, 4096, 563, 4098, 189,
     4096, 563, 0, 8194, 313, 12288, 21, 288, 0, 313, 12288, 21, 288, 18, 313,
@@ -347,9 +345,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     12288, 21, 306, 18, 313, 4096, 563, 4098, 189, 4096, 563, 0, 8196, 313,
     4096, 563, 4098, 189, 4103, 563, 4098, 189, 36864, 563, 16, 4102, 563,
     4103, 189, 20482, 189, 1, 4096, 189
-},
-// jungleShrine28
-{
+};
+
+constexpr uint16_t jungleShrine28[]{
     3850, 4101, 189, 20482, 189, 1, 4097, 189, 4096, 562, 36869, 562, 2048,
     4096, 563, 4097, 189, 4096, 562, 36869, 562, 2048, 4096, 563, 4097, 189,
     4096, 562, 36869, 562, 2048, 4096, 563, 4097, 189, 4096, 562, 36869, 562,
@@ -362,18 +360,18 @@ std::vector<std::vector<uint16_t>> shrineData{
     4097, 189, 4096, 562, 36869, 562, 2048, 4096, 563, 4097, 189, 4096, 562,
     36869, 562, 2048, 4096, 563, 4097, 189, 4096, 562, 36869, 562, 2048, 4096,
     563, 4102, 189, 20482, 189, 1, 4096, 189
-},
-// jungleShrine29
-{
+};
+
+constexpr uint16_t jungleShrine29[]{
     2315, 4097, 189, 20488, 189, 1, 4096, 189, 4101, 158, 36866, 158, 2048,
     4097, 189, 4097, 158, 12288, 158, 42, 12288, 21, 288, 0, 42, 12288, 21,
     288, 18, 42, 4096, 158, 2, 4097, 189, 4097, 158, 12288, 158, 42, 12288, 21,
     306, 0, 42, 12288, 21, 306, 18, 42, 4096, 158, 2, 4097, 189, 4097, 158,
     12290, 158, 42, 4096, 158, 2, 4097, 189, 4101, 158, 2, 4097, 189, 4101,
     158, 2, 4097, 189, 4101, 158, 36866, 158, 2048, 4106, 189, 20480, 189, 1
-},
-// jungleShrine30
-{
+};
+
+constexpr uint16_t jungleShrine30[]{
     3082, 4103, 189, 20480, 189, 1, 4099, 189, 4, 4096, 59, 4098, 189, 1,
     36864, 383, 8, 4098, 383, 4096, 59, 4097, 189, 1, 36864, 383, 24, 4099,
     383, 4096, 59, 4097, 189, 0, 4096, 383, 12292, 383, 78, 4096, 59, 4097,
@@ -383,9 +381,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     8, 12292, 383, 78, 4096, 59, 4097, 189, 1, 36864, 383, 8, 4099, 383, 4096,
     59, 4098, 189, 1, 36864, 383, 16, 4098, 383, 4096, 59, 4100, 189, 3, 4096,
     59, 4104, 189, 20480, 189, 1, 4096, 189
-},
-// jungleShrine31
-{
+};
+
+constexpr uint16_t jungleShrine31[]{
     2569, 4102, 189, 20480, 189, 1, 4097, 189, 4098, 158, 2, 4096, 59, 4097,
     189, 4096, 158, 8192, 78, 12288, 4, 22, 66, 78, 8194, 78, 4096, 59, 4097,
     189, 4096, 158, 8196, 78, 4096, 59, 4097, 189, 4096, 158, 8196, 78, 4096,
@@ -394,9 +392,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     8192, 78, 4096, 59, 4097, 189, 4096, 158, 8192, 78, 12288, 21, 378, 0, 78,
     12288, 21, 378, 18, 78, 12288, 19, 72, 36, 78, 8192, 78, 4096, 59, 4097,
     189, 4101, 158, 4096, 59, 4098, 189, 20485, 189, 1, 4096, 189
-},
-// jungleShrine32
-{
+};
+
+constexpr uint16_t jungleShrine32[]{
     2566, 4099, 189, 20481, 189, 1, 4096, 189, 8193, 73, 8192, 139, 4096, 120,
     4097, 189, 8193, 73, 8192, 139, 4096, 120, 4097, 189, 8192, 73, 8193, 139,
     4096, 120, 4097, 189, 8192, 73, 12288, 21, 288, 0, 73, 12288, 21, 288, 18,
@@ -404,9 +402,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     18, 42, 4096, 120, 4097, 189, 8192, 73, 8193, 139, 4096, 120, 4097, 189,
     8193, 73, 8192, 139, 4096, 120, 4097, 189, 8193, 73, 8192, 139, 4096, 120,
     4100, 189, 20481, 189, 1
-},
-// jungleShrine33
-{
+};
+
+constexpr uint16_t jungleShrine33[]{
     3080, 20482, 189, 1, 4101, 189, 4096, 226, 4100, 59, 4097, 189, 4097, 226,
     4099, 59, 4097, 189, 4098, 226, 4098, 59, 4097, 189, 4100, 226, 4096, 59,
     4097, 189, 4096, 226, 12288, 226, 112, 12288, 21, 360, 0, 112, 12288, 21,
@@ -414,16 +412,16 @@ std::vector<std::vector<uint16_t>> shrineData{
     112, 12288, 21, 378, 18, 112, 4096, 226, 4096, 59, 4097, 189, 4100, 226,
     4096, 59, 4097, 189, 4098, 226, 4098, 59, 4097, 189, 4097, 226, 4099, 59,
     4097, 189, 4096, 226, 4100, 59, 4096, 189, 20482, 189, 1, 4100, 189
-},
-// jungleShrine34
-{
+};
+
+constexpr uint16_t jungleShrine34[]{
     1542, 4102, 189, 2, 4096, 19, 54, 594, 4097, 189, 0, 12288, 21, 360, 0,
     112, 12288, 21, 360, 18, 112, 12288, 19, 0, 594, 112, 4097, 189, 0, 12288,
     21, 378, 0, 112, 12288, 21, 378, 18, 112, 12288, 19, 0, 594, 112, 4097,
     189, 2, 4096, 19, 72, 594, 4102, 189
-},
-// jungleShrine35
-{
+};
+
+constexpr uint16_t jungleShrine35[]{
     2315, 20490, 189, 1, 4096, 189, 12296, 226, 112, 4097, 189, 12296, 226,
     112, 4097, 189, 12289, 226, 112, 12288, 34, 0, 756, 112, 12288, 34, 0, 774,
     112, 12288, 34, 0, 792, 112, 8193, 112, 12289, 226, 112, 4097, 189, 12289,
@@ -433,9 +431,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     112, 12288, 34, 36, 792, 112, 12288, 21, 378, 0, 112, 12288, 21, 378, 18,
     112, 12289, 226, 112, 4097, 189, 12296, 226, 112, 4097, 189, 12296, 226,
     112, 4096, 189, 20490, 189, 1
-},
-// jungleShrine36
-{
+};
+
+constexpr uint16_t jungleShrine36[]{
     3083, 4104, 189, 20481, 189, 1, 4096, 189, 4100, 158, 4096, 10, 36, 648,
     4096, 10, 0, 666, 4096, 10, 36, 684, 4096, 158, 4097, 189, 4096, 158,
     12288, 42, 18, 684, 42, 45056, 42, 18, 702, 42, 256, 40963, 42, 256, 45056,
@@ -452,17 +450,17 @@ std::vector<std::vector<uint16_t>> shrineData{
     42, 18, 684, 42, 45056, 42, 18, 702, 42, 256, 40963, 42, 256, 45056, 135,
     0, 108, 42, 256, 4096, 158, 4097, 189, 4100, 158, 4096, 10, 18, 648, 4096,
     10, 36, 666, 4096, 10, 18, 684, 4096, 158, 4105, 189, 20481, 189, 1
-},
-// jungleShrine37
-{
+};
+
+constexpr uint16_t jungleShrine37[]{
     2570, 4102, 189, 20482, 189, 1, 4096, 189, 5, 4097, 226, 4097, 189, 5,
     4097, 226, 4097, 189, 2, 4096, 4, 0, 220, 4099, 226, 4097, 189, 4096, 21,
     360, 0, 4096, 21, 360, 18, 4101, 226, 4097, 189, 4096, 21, 378, 0, 4096,
     21, 378, 18, 4101, 226, 4097, 189, 2, 4096, 4, 0, 220, 4099, 226, 4097,
     189, 5, 4097, 226, 4097, 189, 5, 4097, 226, 4103, 189, 20482, 189, 1
-},
-// jungleShrine38
-{
+};
+
+constexpr uint16_t jungleShrine38[]{
     3337, 4101, 189, 20482, 189, 1, 4096, 189, 5, 4096, 226, 4097, 189, 4097,
     226, 4096, 120, 36866, 226, 2048, 4096, 120, 4097, 189, 4096, 226, 8192,
     112, 12288, 4, 22, 462, 112, 8192, 24, 8193, 112, 4096, 226, 4097, 189,
@@ -474,9 +472,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     8192, 112, 12288, 4, 44, 462, 112, 8192, 112, 8192, 24, 8192, 112, 4096,
     120, 4097, 189, 4098, 226, 36864, 120, 2048, 36865, 226, 2048, 4096, 226,
     4097, 189, 5, 4096, 226, 4102, 189, 20482, 189, 1
-},
-// jungleShrine39
-{
+};
+
+constexpr uint16_t jungleShrine39[]{
     3335, 4100, 189, 20481, 189, 1, 4096, 189, 4096, 120, 36866, 120, 2048,
     4096, 120, 4097, 189, 4096, 59, 8194, 24, 4096, 120, 4097, 189, 4096, 59,
     8192, 24, 12288, 186, 1296, 0, 24, 12288, 186, 1296, 18, 24, 4096, 59,
@@ -488,9 +486,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     12288, 21, 378, 0, 24, 12288, 21, 378, 18, 24, 4096, 59, 4097, 189, 4096,
     59, 8194, 24, 4096, 120, 4097, 189, 4096, 120, 8194, 24, 4096, 120, 4097,
     189, 4096, 120, 36866, 120, 2048, 4096, 120, 4101, 189, 20481, 189, 1
-},
-// jungleShrine40
-{
+};
+
+constexpr uint16_t jungleShrine40[]{
     2058, 4103, 189, 20481, 189, 1, 4096, 189, 4096, 120, 4097, 119, 4096, 120,
     36866, 119, 2048, 4096, 120, 4097, 189, 4096, 119, 8192, 24, 12288, 33, 0,
     242, 23, 12288, 19, 108, 594, 24, 8193, 23, 8192, 24, 4096, 119, 4097, 189,
@@ -500,9 +498,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     33, 0, 242, 24, 12288, 19, 126, 594, 24, 8192, 24, 8192, 23, 8192, 24,
     4096, 120, 4097, 189, 4097, 119, 4097, 120, 36864, 120, 2048, 36865, 119,
     2048, 4096, 119, 4104, 189, 20481, 189, 1
-},
-// jungleShrine41
-{
+};
+
+constexpr uint16_t jungleShrine41[]{
     2058, 4096, 189, 20487, 189, 1, 4097, 189, 36864, 120, 2048, 4098, 120,
     36865, 120, 2048, 4097, 120, 4097, 189, 0, 8192, 24, 8192, 247, 8194, 24,
     8192, 247, 4096, 59, 4097, 189, 0, 8196, 24, 8192, 247, 4096, 59, 4097,
@@ -511,9 +509,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     8192, 24, 8192, 247, 12288, 21, 378, 0, 24, 12288, 21, 378, 18, 24, 4096,
     120, 4097, 189, 4096, 120, 36864, 120, 2048, 4097, 120, 4096, 59, 4098,
     120, 4097, 189, 20487, 189, 1, 4096, 189
-},
-// jungleShrine42
-{
+};
+
+constexpr uint16_t jungleShrine42[]{
     2059, 4096, 189, 20489, 189, 1, 4096, 189, 4098, 226, 0, 4098, 226, 0,
     4096, 226, 4097, 189, 4096, 226, 12288, 4, 0, 462, 23, 4098, 226, 12288, 4,
     0, 462, 23, 4098, 226, 4097, 189, 4096, 226, 8192, 23, 12288, 21, 360, 0,
@@ -523,16 +521,16 @@ std::vector<std::vector<uint16_t>> shrineData{
     378, 0, 23, 4096, 226, 4097, 189, 4096, 226, 12288, 4, 0, 462, 23, 4098,
     226, 12288, 4, 0, 462, 23, 4098, 226, 4097, 189, 4098, 226, 0, 4098, 226,
     0, 4096, 226, 4097, 189, 20489, 189, 1
-},
-// jungleShrine43
-{
+};
+
+constexpr uint16_t jungleShrine43[]{
     1542, 20484, 189, 1, 4097, 189, 4096, 120, 4098, 119, 4097, 189, 4096, 120,
     12288, 21, 360, 0, 112, 12288, 21, 360, 18, 112, 4096, 119, 4097, 189,
     4096, 120, 12288, 21, 378, 0, 112, 12288, 21, 378, 18, 112, 4096, 119,
     4097, 189, 4096, 120, 4098, 119, 4096, 189, 20484, 189, 1, 4096, 189
-},
-// jungleShrine44
-{
+};
+
+constexpr uint16_t jungleShrine44[]{
     2314, 4102, 189, 20482, 189, 1, 4096, 189, 36864, 226, 8, 4096, 226, 36868,
     119, 2048, 4096, 120, 4097, 189, 4096, 226, 8192, 112, 8195, 23, 8192, 24,
     4096, 120, 4097, 189, 4096, 226, 8192, 112, 12288, 33, 0, 242, 23, 12288,
@@ -543,9 +541,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     8194, 23, 12288, 21, 378, 0, 23, 12288, 21, 378, 18, 24, 4096, 120, 4097,
     189, 36864, 226, 16, 4096, 226, 4100, 119, 4096, 120, 4098, 189, 20487,
     189, 1
-},
-// jungleShrine45
-{
+};
+
+constexpr uint16_t jungleShrine45[]{
     2054, 4102, 189, 4096, 19, 288, 594, 4097, 19, 108, 594, 4096, 19, 288,
     594, 4097, 189, 36864, 19, 468, 594, 16, 36865, 19, 90, 594, 8, 36864, 19,
     468, 594, 16, 4097, 189, 4096, 19, 0, 594, 4096, 21, 360, 0, 4096, 21, 360,
@@ -553,9 +551,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     21, 378, 18, 4096, 19, 0, 594, 4097, 189, 36864, 19, 450, 594, 24, 36865,
     19, 90, 594, 8, 36864, 19, 450, 594, 24, 4097, 189, 4096, 19, 270, 594,
     4097, 19, 126, 594, 4096, 19, 270, 594, 4102, 189
-},
-// jungleShrine46
-{
+};
+
+constexpr uint16_t jungleShrine46[]{
     1544, 4104, 189, 12289, 19, 54, 594, 67, 12288, 4, 0, 44, 67, 12288, 19,
     108, 594, 67, 12289, 19, 54, 594, 67, 4097, 189, 45056, 19, 450, 594, 67,
     24, 12288, 19, 0, 594, 67, 12288, 21, 360, 0, 67, 12288, 21, 360, 18, 67,
@@ -564,18 +562,18 @@ std::vector<std::vector<uint16_t>> shrineData{
     378, 18, 67, 45056, 19, 468, 594, 67, 16, 12288, 19, 0, 594, 67, 4097, 189,
     12289, 19, 72, 594, 67, 12288, 4, 0, 44, 67, 12288, 19, 126, 594, 67,
     12289, 19, 72, 594, 67, 4104, 189
-},
-// jungleShrine47
-{
+};
+
+constexpr uint16_t jungleShrine47[]{
     2053, 4099, 189, 20480, 189, 1, 4096, 189, 0, 4096, 15, 18, 480, 4096, 15,
     18, 498, 4097, 189, 4096, 33, 0, 242, 4096, 14, 486, 0, 4096, 14, 486, 18,
     4097, 189, 0, 4096, 14, 504, 0, 4096, 14, 504, 18, 4097, 189, 0, 4096, 14,
     522, 0, 4096, 14, 522, 18, 4097, 189, 0, 4096, 21, 360, 0, 4096, 21, 360,
     18, 4097, 189, 0, 4096, 21, 378, 0, 4096, 21, 378, 18, 4100, 189, 20480,
     189, 1
-},
-// jungleShrine48
-{
+};
+
+constexpr uint16_t jungleShrine48[]{
     2569, 4101, 189, 20482, 189, 1, 4096, 189, 36864, 119, 24, 36868, 119,
     2048, 4096, 120, 4097, 189, 4096, 119, 8192, 23, 12288, 33, 0, 242, 23,
     12288, 19, 108, 594, 23, 0, 8192, 23, 4096, 120, 4097, 189, 4096, 119,
@@ -586,9 +584,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     23, 8, 4096, 120, 4097, 189, 4096, 119, 8192, 23, 12288, 33, 0, 242, 23,
     12288, 19, 126, 594, 23, 8193, 23, 4096, 120, 4097, 189, 36864, 119, 16,
     36868, 119, 2048, 4096, 120, 4102, 189, 20482, 189, 1
-},
-// jungleShrine49
-{
+};
+
+constexpr uint16_t jungleShrine49[]{
     2316, 4105, 189, 20481, 189, 1, 4096, 189, 4101, 120, 4096, 10, 0, 810,
     4096, 10, 0, 828, 4096, 10, 0, 846, 4096, 120, 4097, 189, 4096, 120, 8199,
     247, 4096, 120, 4097, 189, 4096, 120, 8193, 247, 12288, 21, 360, 0, 247,
@@ -599,9 +597,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     4096, 120, 4097, 189, 4096, 120, 8199, 247, 4096, 120, 4097, 189, 4101,
     120, 4096, 10, 0, 810, 4096, 10, 0, 828, 4096, 10, 0, 846, 4096, 120, 4106,
     189, 20481, 189, 1
-},
-// jungleShrine50
-{
+};
+
+constexpr uint16_t jungleShrine50[]{
     2062, 4100, 189, 20483, 189, 1, 4101, 189, 4096, 562, 4096, 10, 0, 108,
     4096, 10, 0, 126, 4096, 10, 18, 144, 4103, 562, 4097, 189, 4096, 562, 8194,
     67, 12288, 19, 54, 792, 67, 8192, 67, 12288, 33, 18, 198, 67, 12288, 19,
@@ -613,9 +611,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     12288, 19, 126, 792, 67, 8194, 67, 4096, 562, 4097, 189, 4096, 562, 4096,
     10, 18, 108, 4096, 10, 18, 126, 4096, 10, 18, 144, 4103, 562, 4101, 189,
     20483, 189, 1, 4100, 189
-},
-// jungleShrine51
-{
+};
+
+constexpr uint16_t jungleShrine51[]{
     2572, 4108, 189, 9, 4097, 189, 12288, 4, 0, 462, 313, 45056, 19, 396, 792,
     313, 16, 45057, 19, 342, 792, 313, 24, 45058, 19, 396, 792, 313, 16, 45056,
     19, 342, 792, 313, 24, 12288, 19, 36, 792, 313, 12288, 4, 0, 462, 313,
@@ -635,17 +633,17 @@ std::vector<std::vector<uint16_t>> shrineData{
     313, 24, 45057, 19, 360, 792, 313, 16, 45058, 19, 378, 792, 313, 24, 45056,
     19, 360, 792, 313, 16, 12288, 19, 18, 792, 313, 12288, 4, 0, 462, 313,
     4097, 189, 9, 4108, 189
-},
-// jungleShrine52
-{
+};
+
+constexpr uint16_t jungleShrine52[]{
     2055, 4103, 189, 4100, 562, 4097, 189, 4096, 562, 1, 4096, 19, 54, 414, 0,
     4097, 189, 4096, 562, 4096, 21, 360, 0, 4096, 21, 360, 18, 4096, 19, 0,
     414, 0, 4097, 189, 4096, 562, 4096, 21, 378, 0, 4096, 21, 378, 18, 4096,
     19, 0, 414, 0, 4097, 189, 4096, 562, 1, 4096, 19, 72, 414, 0, 4097, 189,
     4100, 562, 4103, 189
-},
-// jungleShrine53
-{
+};
+
+constexpr uint16_t jungleShrine53[]{
     2568, 4099, 189, 20483, 189, 1, 4096, 189, 4, 4096, 563, 4097, 189, 0,
     12288, 4, 0, 220, 67, 8194, 313, 4096, 563, 4097, 189, 0, 8192, 313, 8192,
     67, 8193, 313, 4096, 563, 4097, 189, 0, 8192, 313, 8192, 67, 12288, 21,
@@ -653,9 +651,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     12288, 21, 378, 0, 313, 12288, 21, 378, 18, 313, 4096, 563, 4097, 189, 0,
     8194, 313, 8192, 67, 4096, 563, 4097, 189, 0, 12288, 4, 0, 220, 67, 8193,
     313, 8192, 67, 4096, 563, 4097, 189, 4, 4096, 563, 4100, 189, 20483, 189, 1
-},
-// jungleShrine54
-{
+};
+
+constexpr uint16_t jungleShrine54[]{
     2062, 4096, 189, 20484, 189, 1, 4104, 189, 4098, 119, 4098, 120, 4099, 119,
     4097, 120, 4097, 189, 4096, 119, 8192, 23, 8193, 24, 8194, 23, 12288, 4, 0,
     462, 23, 12288, 19, 108, 414, 23, 8193, 24, 4096, 120, 4097, 189, 4096,
@@ -666,9 +664,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     8194, 23, 8193, 24, 12288, 4, 0, 462, 23, 12288, 19, 126, 414, 23, 8192,
     23, 8192, 24, 4096, 119, 4097, 189, 4096, 119, 4097, 120, 4100, 119, 4098,
     120, 4096, 119, 4097, 189, 20484, 189, 1, 4103, 189
-},
-// jungleShrine55
-{
+};
+
+constexpr uint16_t jungleShrine55[]{
     3337, 20488, 189, 1, 4096, 189, 4096, 226, 4, 4096, 59, 4097, 189, 4096,
     226, 4100, 158, 4096, 120, 4097, 189, 4096, 226, 8196, 139, 4096, 120,
     4097, 189, 4096, 226, 8192, 139, 8192, 42, 8192, 139, 12288, 21, 360, 0,
@@ -679,9 +677,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     139, 8192, 42, 8192, 139, 8192, 42, 8192, 139, 4096, 120, 4097, 189, 4096,
     226, 8196, 139, 4096, 120, 4097, 189, 4096, 226, 36868, 158, 2048, 4096,
     120, 4097, 189, 4096, 226, 4, 4096, 59, 4102, 189, 20482, 189, 1
-},
-// jungleShrine56
-{
+};
+
+constexpr uint16_t jungleShrine56[]{
     2569, 4105, 189, 0, 8192, 42, 0, 8192, 42, 0, 8192, 42, 0, 4097, 189, 8192,
     139, 8192, 42, 8192, 139, 8192, 42, 8192, 139, 8192, 42, 8192, 139, 4097,
     189, 8192, 139, 12288, 4, 0, 220, 42, 8192, 139, 8192, 42, 8192, 139,
@@ -693,9 +691,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     0, 220, 42, 8192, 139, 4097, 189, 8192, 139, 8192, 42, 8192, 139, 8192, 42,
     8192, 139, 8192, 42, 8192, 139, 4097, 189, 0, 8192, 42, 0, 8192, 42, 0,
     8192, 42, 0, 4105, 189
-},
-// jungleShrine57
-{
+};
+
+constexpr uint16_t jungleShrine57[]{
     4363, 4104, 189, 20481, 189, 1, 4096, 189, 0, 4099, 120, 4096, 10, 36, 108,
     4096, 10, 18, 126, 4096, 10, 36, 144, 4096, 158, 4097, 189, 0, 4096, 120,
     8192, 42, 12288, 33, 0, 242, 42, 12288, 19, 108, 414, 42, 8194, 42, 4096,
@@ -714,9 +712,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     384, 12288, 384, 42, 8196, 42, 4096, 158, 4097, 189, 0, 36864, 384, 8,
     4098, 120, 4096, 10, 0, 108, 4096, 10, 0, 126, 4096, 10, 0, 144, 4096, 158,
     4105, 189, 20481, 189, 1
-},
-// jungleShrine58
-{
+};
+
+constexpr uint16_t jungleShrine58[]{
     2312, 20487, 189, 1, 4096, 189, 36864, 120, 2048, 4097, 120, 4098, 119,
     4097, 189, 36864, 120, 2048, 0, 8192, 42, 12288, 21, 360, 0, 42, 12288, 21,
     360, 18, 42, 4096, 119, 4097, 189, 4096, 120, 0, 8192, 42, 12288, 21, 378,
@@ -725,9 +723,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     119, 8192, 42, 12288, 4, 0, 462, 42, 12288, 19, 126, 414, 42, 8192, 42,
     4096, 119, 4097, 189, 4097, 119, 36866, 120, 2048, 4096, 119, 4102, 189,
     20481, 189, 1
-},
-// jungleShrine59
-{
+};
+
+constexpr uint16_t jungleShrine59[]{
     3599, 4105, 189, 20483, 189, 1, 4097, 189, 10, 4099, 189, 3, 36864, 383,
     16, 36864, 383, 40, 5, 4098, 189, 2, 8192, 60, 8192, 78, 12288, 383, 78, 3,
     8193, 60, 4098, 189, 1, 12289, 384, 60, 4096, 383, 12290, 383, 78, 4096,
@@ -744,9 +742,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     12288, 383, 60, 12291, 384, 60, 4096, 383, 12288, 383, 78, 4098, 189, 3,
     8192, 78, 12288, 383, 60, 8193, 60, 0, 4096, 384, 12288, 384, 78, 8192, 78,
     4098, 189, 11, 4108, 189, 20482, 189, 1, 4096, 189
-},
-// jungleShrine60
-{
+};
+
+constexpr uint16_t jungleShrine60[]{
     3340, 4101, 189, 20485, 189, 1, 4096, 189, 2, 8192, 247, 4097, 59, 4096,
     120, 12289, 120, 292, 4096, 120, 4097, 189, 1, 12288, 384, 292, 28672, 353,
     292, 4, 20480, 353, 4, 4096, 101, 648, 0, 4096, 101, 648, 18, 12288, 101,
@@ -762,9 +760,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     4097, 189, 1, 4096, 384, 12288, 120, 292, 4, 4096, 158, 4097, 189, 0, 4097,
     384, 12288, 120, 292, 4097, 120, 8194, 292, 4096, 158, 4097, 189, 0, 36864,
     384, 8, 4096, 384, 20484, 353, 4, 8192, 292, 4106, 189, 20482, 189, 1
-},
-// jungleShrine61
-{
+};
+
+constexpr uint16_t jungleShrine61[]{
     3338, 4101, 189, 20483, 189, 1, 4096, 189, 1, 4097, 119, 4097, 120, 4097,
     119, 4097, 189, 0, 4097, 119, 8194, 24, 8192, 23, 4096, 119, 4097, 189, 0,
     4096, 119, 8192, 23, 8192, 73, 8194, 23, 4096, 119, 4097, 189, 0, 8195, 23,
@@ -777,9 +775,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     24, 4096, 120, 4097, 189, 0, 4096, 120, 12288, 120, 24, 8192, 24, 8193, 23,
     8192, 24, 4096, 120, 4097, 189, 1, 4100, 119, 4096, 120, 4102, 189, 20483,
     189, 1
-},
-// jungleShrine62
-{
+};
+
+constexpr uint16_t jungleShrine62[]{
     3596, 4103, 189, 20483, 189, 1, 4096, 189, 0, 36864, 384, 8, 4096, 384,
     4099, 383, 4098, 158, 4097, 189, 0, 4098, 384, 4098, 383, 4098, 158, 4097,
     189, 0, 4097, 384, 0, 36864, 383, 32, 4096, 377, 0, 0, 4096, 377, 0, 18,
@@ -793,9 +791,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     158, 36864, 158, 40, 4097, 189, 0, 4098, 383, 36864, 383, 40, 4097, 383,
     4098, 158, 4097, 189, 0, 36864, 383, 16, 4100, 383, 4098, 158, 4097, 189,
     2, 4096, 383, 1, 4108, 189, 20483, 189, 1
-},
-// jungleShrine63
-{
+};
+
+constexpr uint16_t jungleShrine63[]{
     2570, 4100, 189, 20483, 189, 1, 4097, 189, 4103, 119, 4097, 189, 4096, 119,
     36864, 120, 32, 36864, 120, 16, 4097, 120, 36864, 120, 32, 36864, 120, 16,
     4096, 119, 4097, 189, 4096, 119, 36864, 120, 40, 0, 36864, 120, 16, 36864,
@@ -807,9 +805,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     120, 40, 0, 36864, 120, 16, 4096, 119, 4097, 189, 4096, 119, 36864, 120,
     40, 36864, 120, 24, 4097, 120, 36864, 120, 40, 36864, 120, 24, 4096, 119,
     4097, 189, 4103, 119, 4101, 189, 20483, 189, 1, 4096, 189
-},
-// jungleShrine64
-{
+};
+
+constexpr uint16_t jungleShrine64[]{
     3085, 4105, 189, 20482, 189, 1, 4096, 189, 1, 20480, 158, 28, 53248, 158,
     28, 40, 5, 4096, 45, 4097, 189, 0, 36864, 45, 8, 20480, 158, 28, 61440,
     158, 10, 28, 16, 61440, 158, 10, 28, 40, 8196, 10, 4096, 45, 4097, 189, 0,
@@ -824,9 +822,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     4097, 189, 0, 36864, 45, 8, 20480, 158, 28, 61440, 158, 10, 28, 24, 61440,
     158, 60, 28, 32, 8193, 60, 8194, 10, 4096, 45, 4097, 189, 1, 20480, 158,
     28, 53248, 158, 28, 32, 5, 4096, 45, 4106, 189, 20482, 189, 1
-},
-// jungleShrine65
-{
+};
+
+constexpr uint16_t jungleShrine65[]{
     3081, 4101, 189, 20482, 189, 1, 4096, 189, 3, 4096, 45, 8192, 10, 4096, 45,
     4097, 189, 2, 4096, 45, 8193, 10, 4096, 45, 4097, 189, 1, 4096, 45, 8194,
     10, 4096, 45, 4097, 189, 0, 4096, 45, 8193, 10, 12288, 19, 36, 36, 139,
@@ -837,9 +835,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     36, 139, 8192, 139, 4096, 45, 4097, 189, 1, 4096, 45, 8193, 10, 24576, 10,
     3840, 4096, 45, 4097, 189, 2, 4096, 45, 8193, 10, 4096, 45, 4097, 189, 3,
     4096, 45, 8192, 10, 4096, 45, 4102, 189, 20482, 189, 1
-},
-// jungleShrine66
-{
+};
+
+constexpr uint16_t jungleShrine66[]{
     6927, 4105, 189, 20483, 189, 1, 4097, 189, 7, 4096, 383, 0, 4096, 384,
     4099, 189, 5, 4097, 384, 4097, 383, 4097, 384, 4098, 189, 4, 4097, 384,
     4098, 383, 4097, 384, 4098, 189, 5, 4096, 384, 4097, 383, 4098, 384, 4098,
@@ -861,9 +859,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     189, 5, 4099, 383, 4097, 384, 4098, 189, 4, 4100, 383, 4096, 384, 4099,
     189, 5, 4097, 384, 4097, 383, 4096, 384, 4099, 189, 5, 36864, 384, 8, 4099,
     384, 4099, 189, 7, 4097, 384, 4107, 189, 20484, 189, 1, 4097, 189
-},
-// jungleShrine67
-{
+};
+
+constexpr uint16_t jungleShrine67[]{
     2570, 4100, 189, 20483, 189, 1, 4097, 189, 2, 4099, 189, 4096, 45, 4097,
     189, 1, 36864, 45, 24, 4100, 45, 4097, 189, 0, 4096, 45, 36864, 45, 32,
     8195, 23, 4096, 45, 4097, 189, 0, 20480, 387, 0, 0, 28, 8194, 23, 12288,
@@ -872,9 +870,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     45, 4097, 189, 0, 4096, 45, 36864, 45, 40, 8195, 23, 4096, 45, 4097, 189,
     1, 36864, 45, 16, 4100, 45, 4097, 189, 2, 4099, 189, 4096, 45, 4101, 189,
     20483, 189, 1, 4096, 189
-},
-// jungleShrine68
-{
+};
+
+constexpr uint16_t jungleShrine68[]{
     3593, 4100, 189, 20483, 189, 1, 4096, 189, 4, 4096, 189, 4096, 120, 4097,
     189, 4, 4096, 119, 4096, 120, 4097, 189, 3, 4096, 45, 4096, 119, 4096, 120,
     4097, 189, 1, 20480, 33, 0, 242, 28, 12288, 19, 90, 414, 10, 4096, 45,
@@ -887,9 +885,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     4096, 120, 4097, 189, 3, 4096, 45, 4096, 119, 4096, 120, 4097, 189, 4,
     4096, 119, 4096, 120, 4097, 189, 4, 4096, 189, 4096, 120, 4101, 189, 20483,
     189, 1
-},
-// jungleShrine69
-{
+};
+
+constexpr uint16_t jungleShrine69[]{
     3085, 4104, 189, 20483, 189, 1, 4096, 189, 4096, 59, 4097, 120, 0, 4098,
     119, 0, 4096, 59, 4097, 120, 4097, 189, 4096, 119, 8192, 24, 4096, 120,
     4096, 59, 0, 8192, 23, 4098, 119, 8192, 24, 4096, 120, 4097, 189, 4096,
@@ -904,9 +902,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     23, 8193, 24, 8193, 247, 4096, 119, 4097, 189, 4096, 120, 8192, 24, 4097,
     120, 4096, 119, 8192, 23, 36866, 59, 2048, 8192, 247, 4096, 119, 4097, 189,
     4098, 120, 0, 4097, 119, 2, 4097, 119, 4105, 189, 20483, 189, 1
-},
-// jungleShrine70
-{
+};
+
+constexpr uint16_t jungleShrine70[]{
     3084, 4111, 189, 36864, 59, 24, 4097, 59, 36864, 59, 40, 4102, 189, 36864,
     120, 24, 4099, 120, 36864, 120, 40, 4100, 189, 36864, 120, 24, 4101, 119,
     36864, 120, 40, 4098, 189, 36864, 59, 24, 4096, 120, 4096, 119, 4099, 45,
@@ -918,9 +916,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     4096, 120, 36864, 59, 32, 4098, 189, 36864, 120, 16, 4101, 119, 36864, 120,
     32, 4100, 189, 36864, 120, 16, 4099, 120, 36864, 120, 32, 4102, 189, 36864,
     59, 16, 4097, 59, 36864, 59, 32, 4111, 189
-},
-// jungleShrine71
-{
+};
+
+constexpr uint16_t jungleShrine71[]{
     4619, 4102, 189, 20483, 189, 1, 4096, 189, 7, 4098, 189, 7, 4096, 120,
     4097, 189, 6, 4097, 120, 4097, 189, 0, 36864, 59, 24, 4097, 120, 20480, 10,
     0, 648, 28, 20480, 10, 36, 666, 28, 20480, 10, 18, 684, 28, 4097, 120,
@@ -938,9 +936,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     4096, 59, 4097, 189, 0, 36864, 120, 16, 4097, 120, 20480, 10, 0, 648, 28,
     20480, 10, 0, 666, 28, 20480, 10, 0, 684, 28, 4097, 120, 4097, 189, 6,
     4097, 120, 4097, 189, 7, 4096, 120, 4097, 189, 7, 4105, 189, 20482, 189, 1
-},
-// jungleShrine72
-{
+};
+
+constexpr uint16_t jungleShrine72[]{
     4878, 4103, 189, 20483, 189, 1, 4098, 189, 5, 36864, 383, 24, 1, 4100, 189,
     2, 4100, 383, 0, 4100, 189, 1, 36864, 383, 8, 4096, 383, 8194, 60, 45056,
     383, 60, 32, 36864, 383, 24, 4100, 189, 0, 36864, 383, 8, 4096, 383, 12290,
@@ -963,9 +961,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     4, 28672, 353, 60, 4, 45056, 383, 60, 8, 4097, 383, 36864, 383, 32, 4098,
     189, 2, 36864, 383, 16, 4098, 383, 36864, 383, 32, 0, 4100, 189, 4, 4096,
     383, 1, 4107, 189, 20483, 189, 1, 4098, 189
-},
-// jungleShrine73
-{
+};
+
+constexpr uint16_t jungleShrine73[]{
     2569, 4101, 189, 20482, 189, 1, 4096, 189, 4098, 158, 2, 4096, 158, 4097,
     189, 4096, 158, 12288, 21, 360, 0, 247, 12288, 21, 360, 18, 67, 12288, 19,
     36, 36, 67, 8192, 73, 8192, 247, 4096, 158, 4097, 189, 4096, 158, 12288,
@@ -977,9 +975,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     4096, 158, 4097, 189, 4096, 158, 8193, 247, 8192, 67, 12288, 86, 36, 0,
     247, 12288, 86, 36, 18, 247, 4096, 158, 4097, 189, 4102, 158, 4099, 189,
     20484, 189, 1, 4096, 189
-},
-// jungleShrine74
-{
+};
+
+constexpr uint16_t jungleShrine74[]{
     3595, 4102, 189, 20482, 189, 1, 4097, 189, 2, 8195, 67, 12288, 59, 247,
     4096, 59, 4097, 189, 2, 8193, 67, 8192, 247, 12289, 59, 247, 4096, 120,
     4097, 189, 1, 8193, 67, 8192, 247, 12288, 59, 247, 4096, 59, 12288, 59,
@@ -996,9 +994,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     378, 0, 67, 12288, 21, 378, 18, 24, 4096, 120, 4097, 189, 0, 36864, 120,
     16, 4099, 120, 12290, 120, 67, 4097, 189, 3, 4097, 189, 12288, 189, 67,
     4097, 59, 4102, 189, 20483, 189, 1, 4096, 189
-},
-// jungleShrine75
-{
+};
+
+constexpr uint16_t jungleShrine75[]{
     2566, 4098, 189, 20481, 189, 1, 4097, 189, 4099, 120, 4097, 189, 4096, 120,
     12288, 21, 360, 0, 42, 12288, 21, 360, 18, 42, 4096, 120, 4097, 189, 4096,
     120, 12288, 21, 378, 0, 42, 12288, 21, 378, 18, 42, 4096, 120, 4097, 189,
@@ -1007,9 +1005,9 @@ std::vector<std::vector<uint16_t>> shrineData{
     4097, 189, 4096, 120, 12288, 287, 0, 0, 42, 12288, 287, 0, 18, 42, 4096,
     120, 4097, 189, 4096, 120, 12288, 287, 18, 0, 42, 12288, 287, 18, 18, 42,
     4096, 120, 4097, 189, 4099, 120, 4098, 189, 20482, 189, 1, 4096, 189
-},
-// jungleShrine76
-{
+};
+
+constexpr uint16_t jungleShrine76[]{
     4103, 4099, 189, 20482, 189, 1, 4096, 189, 3, 4096, 59, 4097, 189, 0,
     45056, 19, 342, 36, 139, 24, 8193, 139, 4096, 59, 4097, 189, 0, 4096, 19,
     216, 36, 4096, 215, 702, 0, 4096, 215, 702, 18, 4096, 59, 4097, 189, 0,
@@ -1023,9 +1021,32 @@ std::vector<std::vector<uint16_t>> shrineData{
     1404, 18, 4096, 59, 4097, 189, 1, 4096, 648, 1422, 0, 4096, 648, 1422, 18,
     4096, 59, 4097, 189, 1, 4096, 648, 1440, 0, 4096, 648, 1440, 18, 4096, 59,
     4100, 189, 20482, 189, 1
-},
+};
+
+constexpr std::span<const uint16_t> shrineData[]{
+    jungleShrine1, jungleShrine2, jungleShrine3, jungleShrine4, jungleShrine5,
+    jungleShrine6, jungleShrine7, jungleShrine8, jungleShrine9, jungleShrine10,
+    jungleShrine11, jungleShrine12, jungleShrine13, jungleShrine14,
+    jungleShrine15, jungleShrine16, jungleShrine17, jungleShrine18,
+    jungleShrine19, jungleShrine20, jungleShrine21, jungleShrine22,
+    jungleShrine23, jungleShrine24, jungleShrine25, jungleShrine26,
+    jungleShrine27, jungleShrine28, jungleShrine29, jungleShrine30,
+    jungleShrine31, jungleShrine32, jungleShrine33, jungleShrine34,
+    jungleShrine35, jungleShrine36, jungleShrine37, jungleShrine38,
+    jungleShrine39, jungleShrine40, jungleShrine41, jungleShrine42,
+    jungleShrine43, jungleShrine44, jungleShrine45, jungleShrine46,
+    jungleShrine47, jungleShrine48, jungleShrine49, jungleShrine50,
+    jungleShrine51, jungleShrine52, jungleShrine53, jungleShrine54,
+    jungleShrine55, jungleShrine56, jungleShrine57, jungleShrine58,
+    jungleShrine59, jungleShrine60, jungleShrine61, jungleShrine62,
+    jungleShrine63, jungleShrine64, jungleShrine65, jungleShrine66,
+    jungleShrine67, jungleShrine68, jungleShrine69, jungleShrine70,
+    jungleShrine71, jungleShrine72, jungleShrine73, jungleShrine74,
+    jungleShrine75, jungleShrine76
 };
 // clang-format on
+
+TileBufferCache shrineCache{shrineData};
 } // namespace
 
 namespace Data
@@ -1033,7 +1054,7 @@ namespace Data
 
 TileBuffer getShrine(int shrineId, const FramedBitset &framedTiles)
 {
-    return {shrineData[shrineId].data(), framedTiles};
+    return shrineCache.get(shrineId, framedTiles);
 }
 
 } // namespace Data
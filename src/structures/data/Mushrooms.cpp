@@ -3,107 +3,112 @@
 namespace
 {
 // clang-format off
-std::vector<std::vector<uint16_t>> mushroomData{
-// mushroom1
-{
+constexpr uint16_t mushroom1[]{
     6427, 4, 4099, 59, 20, 4102, 59, 18, 4103, 59, 18, 4103, 59, 17, 4104, 59,
     17, 4104, 59, 11, 4099, 59, 0, 4105, 59, 7, 4103, 59, 0, 4105, 59, 5, 4105,
     59, 0, 4106, 59, 2, 4107, 59, 0, 4121, 59, 0, 4141, 59, 7, 4112, 59, 9,
     4108, 59, 13, 4107, 59, 14, 4107, 59, 15, 4106, 59, 15, 4106, 59, 16, 4105,
     59, 16, 4106, 59, 16, 4105, 59, 17, 4104, 59, 18, 4104, 59, 18, 4103, 59,
     19, 4101, 59, 13
-},
-// mushroom2
-{
+};
+
+constexpr uint16_t mushroom2[]{
     6169, 5, 4097, 59, 21, 4098, 59, 20, 4099, 59, 19, 4101, 59, 17, 4102, 59,
     17, 4102, 59, 16, 4103, 59, 16, 4103, 59, 16, 4103, 59, 16, 4103, 59, 14,
     4096, 59, 0, 4194, 59, 0, 4103, 59, 4, 4096, 59, 7, 4097, 59, 0, 4102, 59,
     17, 4102, 59, 18, 4101, 59, 18, 4101, 59, 18, 4101, 59, 18, 4101, 59, 19,
     4099, 59, 21, 4098, 59, 22, 4097, 59, 17
-},
-// mushroom3
-{
+};
+
+constexpr uint16_t mushroom3[]{
     4127, 7, 4098, 59, 25, 4100, 59, 24, 4101, 59, 22, 4104, 59, 20, 4105, 59,
     20, 4105, 59, 19, 4106, 59, 19, 4124, 59, 0, 4125, 59, 0, 4126, 59, 0,
     4125, 59, 1, 4104, 59, 13, 4100, 59, 3, 4103, 59, 23, 4102, 59, 24, 4100,
     59, 27, 4097, 59, 21
-},
-// mushroom4
-{
+};
+
+constexpr uint16_t mushroom4[]{
     3609, 7, 4099, 59, 17, 4102, 59, 15, 4104, 59, 13, 4106, 59, 13, 4106, 59,
     12, 4107, 59, 13, 4115, 59, 4, 4117, 59, 3, 4104, 59, 6, 4102, 59, 2, 4103,
     59, 9, 4099, 59, 3, 4102, 59, 11, 4097, 59, 4, 4100, 59, 13, 4096, 59, 5,
     4099, 59, 21, 4097, 59, 15
-},
-// mushroom5
-{
+};
+
+constexpr uint16_t mushroom5[]{
     7195, 6, 4097, 59, 23, 4098, 59, 23, 4099, 59, 21, 4100, 59, 20, 4101, 59,
     20, 4102, 59, 18, 4103, 59, 18, 4103, 59, 17, 4104, 59, 17, 4104, 59, 16,
     4105, 59, 11, 4099, 59, 0, 4105, 59, 0, 4110, 59, 0, 4175, 59, 0, 4121, 59,
     0, 4105, 59, 4, 4105, 59, 1, 4105, 59, 12, 4097, 59, 2, 4104, 59, 17, 4104,
     59, 18, 4103, 59, 18, 4103, 59, 19, 4102, 59, 20, 4100, 59, 21, 4100, 59,
     22, 4099, 59, 23, 4098, 59, 24, 4096, 59, 17
-},
-// mushroom6
-{
+};
+
+constexpr uint16_t mushroom6[]{
     3856, 14, 4096, 59, 13, 4097, 59, 12, 4098, 59, 11, 4099, 59, 9, 4099, 59,
     3, 4098, 59, 3, 4099, 59, 3, 4100, 59, 1, 4099, 59, 4, 4105, 59, 5, 4104,
     59, 5, 4103, 59, 7, 4103, 59, 7, 4103, 59, 8, 4103, 59, 8, 4102, 59, 9,
     4101, 59, 6
-},
-// mushroom7
-{
+};
+
+constexpr uint16_t mushroom7[]{
     3089, 4, 4096, 59, 9, 4096, 59, 2, 4099, 59, 6, 4098, 59, 2, 4099, 59, 6,
     4098, 59, 1, 4101, 59, 3, 4099, 59, 2, 4107, 59, 3, 4106, 59, 4, 4104, 59,
     7, 4104, 59, 7, 4104, 59, 7, 4104, 59, 10, 4102, 59, 12, 4098, 59, 7
-},
-// mushroom8
-{
+};
+
+constexpr uint16_t mushroom8[]{
     5141, 3, 4097, 59, 17, 4100, 59, 14, 4101, 59, 13, 4102, 59, 13, 4102, 59,
     9, 4106, 59, 5, 4101, 59, 0, 4103, 59, 3, 4103, 59, 0, 4152, 59, 5, 4107,
     59, 8, 4104, 59, 12, 4103, 59, 12, 4104, 59, 11, 4104, 59, 12, 4103, 59,
     12, 4103, 59, 13, 4103, 59, 14, 4101, 59, 15, 4099, 59, 10
-},
-// mushroom9
-{
+};
+
+constexpr uint16_t mushroom9[]{
     4628, 3, 4098, 59, 15, 4099, 59, 14, 4100, 59, 14, 4100, 59, 13, 4101, 59,
     13, 4101, 59, 13, 4101, 59, 13, 4101, 59, 0, 4107, 59, 0, 4134, 59, 0,
     4101, 59, 0, 4099, 59, 3, 4099, 59, 0, 4101, 59, 13, 4101, 59, 14, 4099,
     59, 15, 4099, 59, 15, 4099, 59, 16, 4098, 59, 17, 4097, 59, 13
-},
-// mushroom10
-{
+};
+
+constexpr uint16_t mushroom10[]{
     3352, 6, 4097, 59, 20, 4098, 59, 18, 4100, 59, 16, 4102, 59, 16, 4102, 59,
     15, 4103, 59, 15, 4117, 59, 0, 4119, 59, 0, 4118, 59, 0, 4103, 59, 8, 4101,
     59, 1, 4102, 59, 17, 4100, 59, 20, 4098, 59, 15
-},
-// mushroom11
-{
+};
+
+constexpr uint16_t mushroom11[]{
     3091, 6, 4096, 59, 15, 4099, 59, 11, 4102, 59, 10, 4103, 59, 9, 4104, 59,
     9, 4109, 59, 4, 4113, 59, 1, 4103, 59, 4, 4100, 59, 2, 4100, 59, 8, 4097,
     59, 2, 4100, 59, 9, 4096, 59, 3, 4098, 59, 16, 4096, 59, 12
-},
-// mushroom12
-{
+};
+
+constexpr uint16_t mushroom12[]{
     5397, 4, 4097, 59, 17, 4099, 59, 16, 4099, 59, 15, 4100, 59, 14, 4101, 59,
     14, 4101, 59, 13, 4102, 59, 13, 4102, 59, 9, 4098, 59, 0, 4178, 59, 0,
     4103, 59, 6, 4099, 59, 1, 4103, 59, 13, 4102, 59, 13, 4101, 59, 15, 4100,
     59, 15, 4100, 59, 16, 4099, 59, 17, 4098, 59, 18, 4096, 59, 13
-},
-// mushroom13
-{
+};
+
+constexpr uint16_t mushroom13[]{
     2828, 10, 4096, 59, 8, 4098, 59, 7, 4098, 59, 1, 4097, 59, 3, 4098, 59, 2,
     4098, 59, 1, 4098, 59, 2, 4103, 59, 3, 4101, 59, 5, 4101, 59, 5, 4101, 59,
     6, 4101, 59, 6, 4100, 59, 4
-},
-// mushroom14
-{
+};
+
+constexpr uint16_t mushroom14[]{
     2574, 12, 4096, 59, 2, 4097, 59, 6, 4097, 59, 1, 4099, 59, 4, 4097, 59, 2,
     4099, 59, 1, 4099, 59, 2, 4104, 59, 3, 4103, 59, 5, 4102, 59, 6, 4102, 59,
     8, 4101, 59, 9, 4098, 59, 6
-},
+};
+
+constexpr std::span<const uint16_t> mushroomData[]{
+    mushroom1, mushroom2, mushroom3, mushroom4, mushroom5, mushroom6,
+    mushroom7, mushroom8, mushroom9, mushroom10, mushroom11, mushroom12,
+    mushroom13, mushroom14
 };
 // clang-format on
+
+TileBufferCache mushroomCache{mushroomData};
 } // namespace
 
 namespace Data
@@ -111,7 +116,7 @@ namespace Data
 
 TileBuffer getMushroom(int mushroomId, const FramedBitset &framedTiles)
 {
-    return {mushroomData[mushroomId].data(), framedTiles};
+    return mushroomCache.get(mushroomId, framedTiles);
 }
 
 } // namespace Data
@@ -5,21 +5,24 @@
 namespace
 {
 // clang-format off
-std::vector<std::vector<uint16_t>> windowData{
-// window1
-{
+constexpr uint16_t window1[]{
     1285, 36869, 189, 2048, 8194, 73, 36865, 189, 2048, 8194, 73, 36865, 189,
     2048, 8194, 73, 36869, 189, 2048
-},
-// window2
-{
+};
+
+constexpr uint16_t window2[]{
     1286, 0, 36864, 189, 2072, 36867, 189, 2048, 36864, 189, 2072, 45056, 189,
     73, 2080, 8194, 73, 36865, 189, 2048, 8195, 73, 36864, 189, 2048, 36864,
     189, 2064, 45056, 189, 73, 2088, 8194, 73, 36864, 189, 2048, 0, 36864, 189,
     2064, 36867, 189, 2048
-},
+};
+
+constexpr std::span<const uint16_t> windowData[]{
+    window1, window2
 };
 // clang-format on
+
+TileBufferCache windowCache{windowData};
 } // namespace
 
 namespace Data
@@ -31,7 +34,7 @@ TileBuffer getWindow(
     int paneWallId,
     const FramedBitset &framedTiles)
 {
-    TileBuffer data{windowData[static_cast<int>(windowId)].data(), framedTiles};
+    TileBuffer data = windowCache.get(static_cast<int>(windowId), framedTiles);
     for (int i = 0; i < data.getWidth(); ++i) {
         for (int j = 0; j < data.getHeight(); ++j) {
             Tile &tile = data.getTile(i, j);
@@ -3,9 +3,7 @@
 namespace
 {
 // clang-format off
-std::vector<std::vector<uint16_t>> roomData{
-// pyramidRoom1
-{
+constexpr uint16_t pyramidRoom1[]{
     9246, 12297, 151, 34, 8192, 235, 8192, 10, 8196, 34, 12310, 151, 34, 8192,
     235, 8192, 10, 8196, 34, 12310, 151, 34, 12288, 577, 235, 12288, 577, 10,
     12292, 577, 34, 12303, 151, 34, 12291, 53, 34, 45058, 151, 34, 1088, 8192,
@@ -81,9 +79,9 @@ std::vector<std::vector<uint16_t>> roomData{
     151, 34, 12288, 577, 235, 12288, 577, 10, 12292, 577, 34, 12310, 151, 34,
     8192, 235, 8192, 10, 8196, 34, 12310, 151, 34, 8192, 235, 8192, 10, 8196,
     34, 12300, 151, 34
-},
-// pyramidRoom2
-{
+};
+
+constexpr uint16_t pyramidRoom2[]{
     9239, 12290, 151, 34, 8192, 235, 8192, 10, 8196, 34, 12303, 151, 34, 8192,
     235, 8192, 10, 8196, 34, 12303, 151, 34, 12288, 577, 235, 12288, 577, 10,
     12292, 577, 34, 12303, 151, 34, 8192, 235, 8192, 10, 8196, 34, 12290, 151,
@@ -142,9 +140,9 @@ std::vector<std::vector<uint16_t>> roomData{
     34, 12288, 484, 18, 18, 34, 12293, 151, 34, 12288, 577, 235, 12288, 577,
     10, 12292, 577, 34, 12303, 151, 34, 8192, 235, 8192, 10, 8196, 34, 12303,
     151, 34, 8192, 235, 8192, 10, 8196, 34, 12300, 151, 34
-},
-// pyramidRoom3
-{
+};
+
+constexpr uint16_t pyramidRoom3[]{
     9238, 12299, 151, 34, 8192, 235, 8192, 10, 8196, 34, 12302, 151, 34, 8192,
     235, 8192, 10, 8196, 34, 12302, 151, 34, 12288, 577, 235, 12288, 577, 10,
     12292, 577, 34, 12293, 151, 34, 12293, 53, 34, 45058, 151, 34, 1088, 8192,
@@ -187,9 +185,9 @@ std::vector<std::vector<uint16_t>> roomData{
     34, 1088, 8192, 235, 8192, 10, 8196, 34, 12302, 151, 34, 12288, 577, 235,
     12288, 577, 10, 12292, 577, 34, 12302, 151, 34, 8192, 235, 8192, 10, 8196,
     34, 12302, 151, 34, 8192, 235, 8192, 10, 8196, 34, 12290, 151, 34
-},
-// pyramidRoom4
-{
+};
+
+constexpr uint16_t pyramidRoom4[]{
     9233, 12294, 151, 34, 8192, 235, 8192, 10, 8196, 34, 12297, 151, 34, 8192,
     235, 8192, 10, 8196, 34, 12297, 151, 34, 12288, 577, 235, 12288, 577, 10,
     12292, 577, 34, 12297, 151, 34, 8192, 235, 8192, 10, 8196, 34, 12297, 151,
@@ -221,9 +219,9 @@ std::vector<std::vector<uint16_t>> roomData{
     34, 12297, 151, 34, 12288, 577, 235, 12288, 577, 10, 12292, 577, 34, 12297,
     151, 34, 8192, 235, 8192, 10, 8196, 34, 12297, 151, 34, 8192, 235, 8192,
     10, 8196, 34, 12290, 151, 34
-},
-// pyramidRoom5
-{
+};
+
+constexpr uint16_t pyramidRoom5[]{
     9237, 12298, 151, 34, 8192, 235, 8192, 10, 8196, 34, 12301, 151, 34, 8192,
     235, 8192, 10, 8196, 34, 12301, 151, 34, 12288, 577, 235, 12288, 577, 10,
     12292, 577, 34, 12301, 151, 34, 8192, 235, 8192, 10, 8196, 34, 12301, 151,
@@ -257,9 +255,9 @@ std::vector<std::vector<uint16_t>> roomData{
     12301, 151, 34, 12288, 577, 235, 12288, 577, 10, 12292, 577, 34, 12301,
     151, 34, 8192, 235, 8192, 10, 8196, 34, 12301, 151, 34, 8192, 235, 8192,
     10, 8196, 34, 12290, 151, 34
-},
-// treeRoom1
-{
+};
+
+constexpr uint16_t treeRoom1[]{
     4622, 12289, 189, 244, 12289, 191, 244, 12288, 189, 244, 12291, 191, 244,
     12288, 189, 244, 12288, 191, 244, 12291, 189, 244, 12293, 191, 244, 45056,
     192, 244, 32, 12290, 191, 244, 12291, 189, 244, 12289, 191, 244, 45056,
@@ -291,9 +289,9 @@ std::vector<std::vector<uint16_t>> roomData{
     191, 244, 12288, 10, 18, 378, 244, 12288, 10, 36, 396, 244, 12288, 10, 0,
     414, 244, 12289, 191, 244, 12293, 189, 244, 12290, 191, 244, 12288, 51,
     244, 8193, 244, 12288, 191, 244, 12291, 189, 244
-},
-// treeRoom2
-{
+};
+
+constexpr uint16_t treeRoom2[]{
     4109, 12288, 189, 244, 12288, 191, 244, 12288, 189, 244, 12290, 191, 244,
     12288, 10, 36, 378, 244, 12288, 10, 36, 396, 244, 12288, 10, 0, 414, 244,
     12288, 191, 244, 12291, 189, 244, 12291, 191, 244, 12288, 51, 244, 8193,
@@ -321,9 +319,9 @@ std::vector<std::vector<uint16_t>> roomData{
     191, 244, 12291, 189, 244, 12292, 191, 244, 12288, 192, 244, 12289, 191,
     244, 12292, 189, 244, 12290, 191, 244, 12288, 192, 244, 12291, 191, 244,
     12290, 189, 244
-},
-// treeRoom3
-{
+};
+
+constexpr uint16_t treeRoom3[]{
     2569, 12289, 189, 244, 12289, 191, 244, 12288, 189, 244, 8194, 244, 12293,
     191, 244, 12288, 10, 36, 378, 244, 12288, 10, 36, 396, 244, 12288, 10, 18,
     414, 244, 12288, 191, 244, 12288, 189, 244, 12288, 191, 244, 45056, 192,
@@ -337,9 +335,9 @@ std::vector<std::vector<uint16_t>> roomData{
     12288, 189, 244, 8192, 244, 12289, 191, 244, 12288, 189, 244, 12291, 191,
     244, 12289, 189, 244, 12288, 191, 244, 12290, 189, 244, 12288, 191, 244,
     12291, 189, 244, 12288, 191, 244, 12290, 189, 244
-},
-// treeRoom4
-{
+};
+
+constexpr uint16_t treeRoom4[]{
     3848, 12293, 191, 244, 12289, 189, 244, 12297, 191, 244, 12288, 51, 244,
     12288, 191, 244, 45056, 191, 244, 32, 12291, 191, 244, 8195, 244, 12289,
     191, 244, 12288, 189, 244, 12288, 191, 244, 8196, 244, 12290, 191, 244,
@@ -353,9 +351,9 @@ std::vector<std::vector<uint16_t>> roomData{
     244, 8195, 244, 12288, 19, 54, 414, 244, 12289, 191, 244, 12288, 192, 244,
     8195, 244, 12288, 19, 72, 414, 244, 12291, 191, 244, 12288, 10, 0, 378,
     244, 12288, 10, 36, 396, 244, 12288, 10, 36, 414, 244, 12289, 191, 244
-},
-// treeRoom5
-{
+};
+
+constexpr uint16_t treeRoom5[]{
     4874, 12288, 189, 244, 12290, 191, 244, 12288, 10, 0, 378, 244, 12288, 10,
     0, 396, 244, 12288, 10, 18, 414, 244, 12289, 191, 244, 12289, 189, 244,
     12289, 191, 244, 45056, 191, 244, 32, 8194, 244, 12290, 191, 244, 12288,
@@ -384,9 +382,9 @@ std::vector<std::vector<uint16_t>> roomData{
     244, 12288, 191, 244, 12288, 189, 244, 12291, 191, 244, 12288, 192, 244,
     8192, 244, 12290, 191, 244, 12288, 189, 244, 12294, 191, 244, 12294, 189,
     244, 12288, 191, 244, 12291, 189, 244
-},
-// treeRoom6
-{
+};
+
+constexpr uint16_t treeRoom6[]{
     3596, 12290, 189, 244, 12294, 191, 244, 12291, 189, 244, 12288, 192, 244,
     12289, 191, 244, 12288, 21, 432, 0, 244, 12288, 21, 432, 18, 244, 12291,
     191, 244, 12289, 189, 244, 12289, 192, 244, 12288, 191, 244, 12288, 192,
@@ -409,9 +407,9 @@ std::vector<std::vector<uint16_t>> roomData{
     12289, 191, 244, 12292, 189, 244, 12288, 192, 244, 12288, 191, 244, 12288,
     10, 0, 378, 244, 12288, 10, 36, 396, 244, 12288, 10, 18, 414, 244, 12288,
     191, 244, 12290, 189, 244
-},
-// treeRoom7
-{
+};
+
+constexpr uint16_t treeRoom7[]{
     3852, 12291, 189, 244, 12288, 191, 244, 8194, 244, 12288, 191, 244, 12292,
     189, 244, 12290, 191, 244, 12288, 10, 36, 378, 244, 12288, 10, 18, 396,
     244, 12288, 10, 0, 414, 244, 12289, 191, 244, 12290, 189, 244, 12289, 191,
@@ -434,9 +432,9 @@ std::vector<std::vector<uint16_t>> roomData{
     191, 244, 12288, 189, 244, 12290, 191, 244, 12288, 51, 244, 12289, 191,
     244, 8192, 244, 12290, 191, 244, 12291, 189, 244, 12293, 191, 244, 12290,
     189, 244
-},
-// treeRoom8
-{
+};
+
+constexpr uint16_t treeRoom8[]{
     4360, 12294, 191, 244, 12288, 189, 244, 12288, 191, 244, 12288, 192, 244,
     12288, 191, 244, 8192, 244, 12288, 51, 244, 12291, 191, 244, 12288, 192,
     244, 8194, 244, 12288, 191, 244, 12288, 192, 244, 12291, 191, 244, 8193,
@@ -453,9 +451,9 @@ std::vector<std::vector<uint16_t>> roomData{
     12288, 192, 244, 12288, 191, 244, 8194, 244, 45056, 191, 244, 8, 12291,
     191, 244, 12288, 51, 244, 8193, 244, 12292, 191, 244, 12288, 10, 18, 378,
     244, 12288, 10, 0, 396, 244, 12288, 10, 0, 414, 244, 12289, 191, 244
-},
-// treeRoom9
-{
+};
+
+constexpr uint16_t treeRoom9[]{
     4108, 12289, 189, 244, 12288, 192, 244, 12288, 191, 244, 8195, 244, 12288,
     192, 244, 12288, 191, 244, 12291, 189, 244, 12289, 191, 244, 8194, 244,
     12288, 51, 244, 12288, 191, 244, 12291, 189, 244, 12290, 191, 244, 12288,
@@ -483,9 +481,9 @@ std::vector<std::vector<uint16_t>> roomData{
     244, 8192, 244, 12293, 191, 244, 12291, 189, 244, 12289, 191, 244, 12288,
     189, 244, 12289, 191, 244, 12288, 192, 244, 12288, 191, 244, 12289, 189,
     244
-},
-// treeRoom10
-{
+};
+
+constexpr uint16_t treeRoom10[]{
     2569, 12289, 189, 244, 12288, 191, 244, 12289, 189, 244, 12288, 191, 244,
     12291, 189, 244, 12289, 191, 244, 12288, 192, 244, 12288, 189, 244, 12288,
     192, 244, 12288, 191, 244, 12290, 189, 244, 12290, 191, 244, 12288, 192,
@@ -500,9 +498,9 @@ std::vector<std::vector<uint16_t>> roomData{
     191, 244, 12288, 10, 18, 378, 244, 12288, 10, 36, 396, 244, 12288, 10, 36,
     414, 244, 12290, 191, 244, 12288, 189, 244, 12289, 192, 244, 12288, 51,
     244, 8193, 244, 12289, 192, 244, 12288, 191, 244, 12288, 189, 244
-},
-// treeRoom11
-{
+};
+
+constexpr uint16_t treeRoom11[]{
     4876, 12290, 189, 244, 12289, 191, 244, 12290, 189, 244, 12288, 191, 244,
     12292, 189, 244, 12289, 191, 244, 12288, 51, 244, 12291, 191, 244, 12288,
     189, 244, 12289, 192, 244, 12288, 189, 244, 12290, 191, 244, 12288, 51,
@@ -532,9 +530,9 @@ std::vector<std::vector<uint16_t>> roomData{
     19, 72, 414, 244, 8194, 244, 45056, 19, 144, 414, 244, 24, 12289, 191, 244,
     12289, 189, 244, 12291, 191, 244, 12288, 10, 18, 378, 244, 12288, 10, 18,
     396, 244, 12288, 10, 0, 414, 244, 12289, 191, 244, 12289, 189, 244
-},
-// treeRoom12
-{
+};
+
+constexpr uint16_t treeRoom12[]{
     4363, 12288, 189, 244, 12288, 191, 244, 12291, 189, 244, 8194, 244, 12290,
     189, 244, 12290, 191, 244, 12288, 189, 244, 12288, 191, 244, 8194, 244,
     12289, 192, 244, 12288, 189, 244, 12288, 192, 244, 12288, 191, 244, 45056,
@@ -562,9 +560,9 @@ std::vector<std::vector<uint16_t>> roomData{
     45056, 191, 244, 24, 12288, 191, 244, 45056, 191, 244, 32, 8192, 244,
     45056, 191, 244, 16, 12288, 191, 244, 12289, 189, 244, 12291, 191, 244,
     12289, 189, 244, 12289, 191, 244, 12288, 189, 244
-},
-// treeRoom13
-{
+};
+
+constexpr uint16_t treeRoom13[]{
     4109, 12288, 189, 244, 12290, 191, 244, 12288, 189, 244, 12289, 191, 244,
     12288, 189, 244, 12289, 191, 244, 12291, 189, 244, 12290, 191, 244, 12288,
     189, 244, 12288, 191, 244, 12288, 192, 244, 12289, 189, 244, 12288, 192,
@@ -595,9 +593,9 @@ std::vector<std::vector<uint16_t>> roomData{
     12289, 191, 244, 12293, 189, 244, 12288, 191, 244, 12288, 10, 0, 378, 244,
     12288, 10, 0, 396, 244, 12288, 10, 36, 414, 244, 12288, 191, 244, 12289,
     192, 244, 12289, 189, 244
-},
-// treeRoom14
-{
+};
+
+constexpr uint16_t treeRoom14[]{
     3851, 12290, 189, 244, 12291, 191, 244, 12288, 10, 18, 378, 244, 12288, 10,
     18, 396, 244, 12288, 10, 18, 414, 244, 12288, 191, 244, 12289, 189, 244,
     12289, 191, 244, 12290, 51, 244, 8194, 244, 12288, 191, 244, 12288, 189,
@@ -621,9 +619,17 @@ std::vector<std::vector<uint16_t>> roomData{
     244, 12290, 191, 244, 12288, 192, 244, 8192, 244, 12288, 21, 450, 0, 244,
     12288, 21, 450, 18, 244, 12289, 192, 244, 12288, 191, 244, 12289, 189, 244,
     12295, 191, 244, 12294, 189, 244, 12289, 191, 244, 12290, 189, 244
-},
+};
+
+constexpr std::span<const uint16_t> roomData[]{
+    pyramidRoom1, pyramidRoom2, pyramidRoom3, pyramidRoom4, pyramidRoom5,
+    treeRoom1, treeRoom2, treeRoom3, treeRoom4, treeRoom5, treeRoom6,
+    treeRoom7, treeRoom8, treeRoom9, treeRoom10, treeRoom11, treeRoom12,
+    treeRoom13, treeRoom14
 };
 // clang-format on
+
+TileBufferCache roomCache{roomData};
 } // namespace
 
 namespace Data
@@ -631,7 +637,7 @@ namespace Data
 
 TileBuffer getRoom(int roomId, const FramedBitset &framedTiles)
 {
-    return {roomData[roomId].data(), framedTiles};
+    return roomCache.get(roomId, framedTiles);
 }
 
 } // namespace Data
@@ -3,9 +3,7 @@
 namespace
 {
 // clang-format off
-std::vector<std::vector<uint16_t>> skyBoxData{
-// skyBox1
-{
+constexpr uint16_t skyBox1[]{
     4623, 4107, 189, 20482, 189, 1, 4096, 189, 11, 4096, 202, 4097, 189, 4108,
     202, 4097, 189, 4108, 202, 4097, 189, 4098, 202, 12288, 91, 144, 0, 90,
     12288, 91, 144, 18, 90, 12288, 91, 144, 36, 90, 8192, 21, 8193, 90, 12288,
@@ -25,9 +23,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     36, 90, 8192, 21, 8193, 90, 12288, 93, 18, 486, 90, 12288, 93, 18, 504, 90,
     12288, 93, 18, 522, 90, 4096, 202, 4097, 189, 4108, 202, 4097, 189, 4108,
     202, 4097, 189, 11, 4096, 202, 4108, 189, 20482, 189, 1
-},
-// skyBox2
-{
+};
+
+constexpr uint16_t skyBox2[]{
     3085, 4105, 189, 20482, 189, 1, 4096, 189, 12288, 240, 1080, 108, 90,
     12288, 240, 1080, 126, 90, 12288, 240, 1080, 144, 90, 8197, 90, 12288, 357,
     90, 4096, 357, 4097, 189, 12288, 240, 1098, 108, 90, 12288, 240, 1098, 126,
@@ -46,9 +44,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     12288, 350, 90, 12288, 357, 90, 4096, 357, 4097, 189, 12288, 240, 1116,
     108, 90, 12288, 240, 1116, 126, 90, 12288, 240, 1116, 144, 90, 8197, 90,
     12288, 357, 90, 4096, 357, 4106, 189, 20482, 189, 1
-},
-// skyBox3
-{
+};
+
+constexpr uint16_t skyBox3[]{
     4365, 4105, 189, 20482, 189, 1, 4096, 189, 0, 36864, 370, 24, 4099, 370,
     4096, 10, 36, 1782, 4096, 10, 18, 1800, 4096, 10, 0, 1818, 4097, 370, 4097,
     189, 0, 4099, 370, 61440, 370, 82, 5632, 32, 24578, 82, 5632, 4097, 370,
@@ -71,9 +69,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     4099, 370, 61440, 370, 82, 5632, 40, 24578, 82, 5632, 4097, 370, 4097, 189,
     0, 36864, 370, 16, 4099, 370, 4096, 10, 0, 1782, 4096, 10, 18, 1800, 4096,
     10, 0, 1818, 4097, 370, 4106, 189, 20482, 189, 1
-},
-// skyBox4
-{
+};
+
+constexpr uint16_t skyBox4[]{
     4626, 4110, 189, 20482, 189, 1, 4096, 189, 4104, 140, 36869, 140, 2048,
     4096, 140, 4097, 189, 4096, 140, 4102, 347, 36869, 347, 2048, 4096, 347,
     4096, 140, 4097, 189, 4096, 140, 4096, 347, 28672, 91, 162, 0, 82, 5632,
@@ -121,9 +119,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     347, 4096, 140, 4097, 189, 4096, 140, 4102, 347, 36869, 347, 2048, 4096,
     347, 4096, 140, 4097, 189, 4104, 140, 36869, 140, 2048, 4096, 140, 4111,
     189, 20482, 189, 1
-},
-// skyBox5
-{
+};
+
+constexpr uint16_t skyBox5[]{
     2573, 4104, 189, 20481, 189, 1, 4098, 189, 0, 36864, 347, 2072, 36870, 347,
     2048, 4096, 347, 4096, 124, 4097, 189, 0, 36871, 347, 2048, 4096, 347,
     4096, 124, 4097, 189, 0, 36871, 347, 2048, 4096, 347, 4096, 124, 4097, 189,
@@ -135,9 +133,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     4096, 124, 4097, 189, 0, 36871, 347, 2048, 4096, 347, 4096, 124, 4097, 189,
     0, 36864, 347, 2064, 36870, 347, 2048, 4096, 347, 4096, 124, 4105, 189,
     20481, 189, 1, 4097, 189
-},
-// skyBox6
-{
+};
+
+constexpr uint16_t skyBox6[]{
     4366, 4106, 189, 20482, 189, 1, 4096, 189, 0, 36864, 357, 24, 4100, 357, 2,
     36864, 202, 8, 4096, 202, 4097, 189, 0, 4096, 357, 8199, 82, 45056, 202,
     82, 8, 4096, 202, 4097, 189, 0, 4096, 357, 8192, 82, 8192, 91, 8192, 21,
@@ -161,9 +159,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     684, 144, 82, 8194, 82, 45056, 19, 180, 396, 82, 16, 4097, 202, 4097, 189,
     0, 4096, 357, 8199, 82, 45056, 202, 82, 8, 4096, 202, 4097, 189, 0, 36864,
     357, 16, 4100, 357, 2, 36864, 202, 8, 4096, 202, 4107, 189, 20482, 189, 1
-},
-// skyBox7
-{
+};
+
+constexpr uint16_t skyBox7[]{
     4109, 4106, 189, 20481, 189, 1, 4096, 189, 20486, 54, 20, 20480, 10, 0,
     1080, 9, 20480, 10, 0, 1098, 9, 20480, 10, 0, 1116, 5, 20480, 54, 5, 4097,
     189, 20480, 54, 20, 8194, 90, 24576, 21, 6656, 12288, 547, 108, 0, 90,
@@ -186,9 +184,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     20, 8199, 90, 8192, 91, 20480, 54, 5, 4097, 189, 20486, 54, 20, 20480, 10,
     0, 1080, 9, 20480, 10, 18, 1098, 9, 20480, 10, 18, 1116, 5, 20480, 54, 5,
     4107, 189, 20481, 189, 1
-},
-// skyBox8
-{
+};
+
+constexpr uint16_t skyBox8[]{
     4384, 4124, 189, 20482, 189, 1, 4096, 189, 6, 4096, 202, 36864, 202, 40,
     19, 4098, 189, 5, 4098, 202, 19, 4098, 189, 4, 4120, 202, 4097, 189, 3,
     4099, 202, 8192, 82, 12288, 88, 702, 0, 90, 12288, 88, 702, 18, 82, 45056,
@@ -245,9 +243,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     114, 20, 20480, 388, 0, 132, 20, 20480, 388, 0, 150, 20, 20480, 388, 0,
     168, 20, 4096, 202, 4097, 189, 5, 4098, 202, 19, 4098, 189, 6, 4096, 202,
     36864, 202, 32, 19, 4126, 189, 20482, 189, 1
-},
-// skyBox9
-{
+};
+
+constexpr uint16_t skyBox9[]{
     9232, 4107, 189, 20482, 189, 1, 4097, 189, 11, 4097, 202, 4097, 189, 0,
     36864, 202, 24, 36864, 202, 40, 7, 36864, 202, 2056, 4097, 202, 4097, 189,
     0, 4097, 202, 36864, 202, 2088, 6, 36864, 202, 2048, 4097, 202, 4097, 189,
@@ -291,9 +289,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     4097, 202, 4097, 189, 0, 36864, 202, 16, 36864, 202, 32, 7, 36864, 202,
     2056, 4097, 202, 4097, 189, 11, 4097, 202, 4108, 189, 20482, 189, 1, 4096,
     189
-},
-// skyBox10
-{
+};
+
+constexpr uint16_t skyBox10[]{
     4365, 4104, 189, 20482, 189, 1, 4097, 189, 4, 4096, 93, 18, 486, 4096, 93,
     18, 504, 4096, 93, 18, 522, 4098, 202, 4097, 189, 6, 8192, 145, 40960, 145,
     1, 4097, 202, 4097, 189, 7, 40960, 145, 1, 4097, 202, 4097, 189, 6, 8192,
@@ -308,9 +306,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     40960, 145, 1, 4097, 202, 4097, 189, 6, 8192, 145, 40960, 145, 1, 4097,
     202, 4097, 189, 4, 4096, 93, 18, 486, 4096, 93, 18, 504, 4096, 93, 18, 522,
     4098, 202, 4105, 189, 20482, 189, 1, 4096, 189
-},
-// skyBox11
-{
+};
+
+constexpr uint16_t skyBox11[]{
     9749, 4111, 189, 20482, 189, 1, 4098, 189, 10, 36864, 202, 24, 4096, 202,
     2, 4098, 202, 4097, 189, 7, 36864, 202, 24, 4099, 202, 4096, 10, 0, 486,
     4096, 10, 36, 504, 4096, 10, 0, 522, 4098, 202, 4097, 189, 7, 4100, 202,
@@ -384,9 +382,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     202, 4096, 10, 0, 486, 4096, 10, 36, 504, 4096, 10, 0, 522, 4098, 202,
     4097, 189, 10, 36864, 202, 16, 4096, 202, 2, 4098, 202, 4112, 189, 20482,
     189, 1, 4097, 189
-},
-// skyBox12
-{
+};
+
+constexpr uint16_t skyBox12[]{
     2570, 4102, 189, 20482, 189, 1, 4096, 189, 6, 4096, 370, 4097, 189, 0,
     12289, 19, 90, 468, 182, 12290, 19, 36, 468, 182, 45056, 19, 144, 468, 182,
     24, 4096, 370, 4097, 189, 0, 45057, 19, 90, 468, 182, 8, 45057, 19, 450,
@@ -400,9 +398,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     19, 0, 468, 182, 12288, 19, 234, 468, 182, 4096, 370, 4097, 189, 0, 12289,
     19, 90, 468, 182, 12290, 19, 18, 468, 182, 45056, 19, 180, 468, 182, 16,
     4096, 370, 4097, 189, 6, 4096, 370, 4103, 189, 20482, 189, 1
-},
-// skyBox13
-{
+};
+
+constexpr uint16_t skyBox13[]{
     5136, 4108, 189, 20482, 189, 1, 4096, 189, 12, 4096, 45, 4097, 189, 11,
     4096, 18, 864, 0, 4096, 45, 4097, 189, 10, 4096, 33, 18, 264, 4096, 18,
     882, 0, 4096, 45, 4097, 189, 10, 4097, 202, 4096, 45, 4097, 189, 11, 4096,
@@ -417,9 +415,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     4097, 189, 10, 4096, 21, 468, 0, 4096, 21, 468, 18, 4096, 45, 4097, 189,
     10, 4096, 21, 486, 0, 4096, 21, 486, 18, 4096, 45, 4097, 189, 12, 4096, 45,
     4109, 189, 20482, 189, 1
-},
-// skyBox14
-{
+};
+
+constexpr uint16_t skyBox14[]{
     3081, 4100, 189, 20483, 189, 1, 4096, 189, 0, 36864, 357, 24, 2, 4099, 189,
     0, 4096, 357, 36864, 350, 40, 2, 4098, 189, 0, 4096, 357, 4096, 350, 36864,
     350, 40, 2, 4097, 189, 0, 4096, 357, 4097, 350, 36864, 350, 40, 0, 36864,
@@ -429,9 +427,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     16, 4097, 189, 0, 4096, 357, 4096, 350, 36864, 350, 32, 2, 4097, 189, 0,
     4096, 357, 36864, 350, 32, 2, 4098, 189, 0, 36864, 357, 16, 2, 4103, 189,
     20483, 189, 1
-},
-// skyBox15
-{
+};
+
+constexpr uint16_t skyBox15[]{
     3084, 4105, 189, 20481, 189, 1, 4096, 189, 0, 36864, 202, 24, 4099, 202,
     4096, 10, 36, 1782, 4096, 10, 0, 1800, 4096, 10, 36, 1818, 4096, 370, 4097,
     189, 0, 4096, 202, 12288, 202, 82, 8197, 82, 4096, 370, 4097, 189, 0, 4096,
@@ -446,9 +444,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     32, 8197, 82, 4096, 370, 4097, 189, 0, 4096, 202, 12288, 202, 82, 8197, 82,
     4096, 370, 4097, 189, 0, 36864, 202, 16, 4099, 202, 4096, 10, 36, 1782,
     4096, 10, 0, 1800, 4096, 10, 0, 1818, 4096, 370, 4106, 189, 20481, 189, 1
-},
-// skyBox16
-{
+};
+
+constexpr uint16_t skyBox16[]{
     5132, 4103, 189, 20482, 189, 1, 4109, 189, 4097, 202, 5, 4099, 189, 4096,
     202, 8198, 82, 4096, 45, 4098, 189, 4096, 202, 8198, 82, 4096, 45, 4098,
     189, 4096, 202, 8192, 82, 12288, 100, 36, 0, 82, 12288, 100, 36, 18, 82,
@@ -470,9 +468,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     4097, 45, 4097, 189, 4096, 202, 8198, 82, 4096, 45, 4098, 189, 4096, 202,
     8198, 82, 4096, 45, 4098, 189, 4097, 202, 5, 4118, 189, 20482, 189, 1,
     4096, 189
-},
-// skyBox17
-{
+};
+
+constexpr uint16_t skyBox17[]{
     3594, 4103, 189, 20481, 189, 1, 4096, 189, 4099, 202, 4096, 10, 36, 1134,
     4096, 10, 18, 1152, 4096, 10, 18, 1170, 4096, 202, 4097, 189, 4096, 202,
     8197, 182, 4096, 202, 4097, 189, 4096, 202, 8195, 182, 12288, 21, 468, 0,
@@ -490,9 +488,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     4097, 189, 4096, 202, 8197, 182, 4096, 202, 4097, 189, 4099, 202, 4096, 10,
     36, 1134, 4096, 10, 0, 1152, 4096, 10, 0, 1170, 4096, 202, 4104, 189,
     20481, 189, 1
-},
-// skyBox18
-{
+};
+
+constexpr uint16_t skyBox18[]{
     6157, 4104, 189, 20483, 189, 1, 4096, 189, 0, 36864, 202, 24, 4097, 202, 4,
     4099, 189, 0, 4096, 202, 36864, 202, 24, 36864, 202, 32, 5, 4098, 189, 0,
     36864, 202, 8, 36864, 202, 32, 6, 4098, 189, 0, 4096, 202, 7, 4096, 202,
@@ -517,9 +515,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     4096, 202, 4097, 189, 0, 36864, 202, 8, 36864, 202, 40, 6, 4098, 189, 0,
     4096, 202, 36864, 202, 16, 36864, 202, 40, 5, 4098, 189, 0, 36864, 202, 16,
     4097, 202, 4, 4107, 189, 20483, 189, 1
-},
-// skyBox19
-{
+};
+
+constexpr uint16_t skyBox19[]{
     4111, 4107, 189, 20482, 189, 1, 4096, 189, 3, 4096, 202, 6, 4098, 189, 3,
     4096, 202, 8198, 182, 4096, 202, 4097, 189, 3, 4096, 202, 8197, 182, 45056,
     202, 182, 8, 4096, 202, 4097, 189, 3, 4096, 202, 8196, 182, 45056, 202,
@@ -538,9 +536,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     202, 182, 8, 12288, 202, 182, 4096, 202, 4097, 189, 3, 4096, 202, 8197,
     182, 45056, 202, 182, 8, 4096, 202, 4097, 189, 3, 4096, 202, 8198, 182,
     4096, 202, 4097, 189, 3, 4096, 202, 6, 4109, 189, 20482, 189, 1
-},
-// skyBox20
-{
+};
+
+constexpr uint16_t skyBox20[]{
     6418, 4105, 189, 20487, 189, 1, 4096, 189, 4111, 202, 4097, 189, 4098, 202,
     4096, 54, 4098, 202, 4096, 54, 4098, 202, 4096, 54, 4099, 202, 4097, 189,
     4096, 202, 4096, 54, 4098, 202, 4096, 54, 4098, 202, 4096, 54, 4098, 202,
@@ -574,9 +572,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     8, 4098, 202, 4097, 189, 12, 4096, 202, 4096, 54, 4096, 202, 4097, 189, 12,
     36864, 202, 8, 4097, 202, 4097, 189, 13, 4097, 202, 4110, 189, 20482, 189,
     1, 4096, 189
-},
-// skyBox21
-{
+};
+
+constexpr uint16_t skyBox21[]{
     4624, 4107, 189, 20483, 189, 1, 4096, 189, 0, 36864, 202, 24, 4101, 202,
     4096, 10, 18, 1728, 4096, 10, 18, 1746, 4096, 10, 0, 1764, 4098, 202, 4097,
     189, 0, 4096, 202, 4100, 370, 4096, 202, 8194, 47, 4096, 202, 4096, 370,
@@ -605,9 +603,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     4097, 189, 0, 4096, 202, 4096, 370, 4104, 202, 4096, 370, 4096, 202, 4097,
     189, 0, 4096, 202, 4106, 370, 4096, 202, 4097, 189, 0, 36864, 202, 16,
     4107, 202, 4105, 189, 20486, 189, 1
-},
-// skyBox22
-{
+};
+
+constexpr uint16_t skyBox22[]{
     5901, 4106, 189, 20481, 189, 1, 4096, 189, 4096, 357, 36864, 357, 40, 6,
     36864, 357, 24, 4096, 357, 4097, 189, 4097, 357, 4102, 561, 4097, 357,
     4097, 189, 4097, 357, 8198, 183, 4097, 357, 4097, 189, 4097, 357, 8198,
@@ -630,9 +628,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     8198, 183, 4097, 357, 4097, 189, 4097, 357, 4102, 561, 4097, 357, 4097,
     189, 4096, 357, 36864, 357, 32, 6, 36864, 357, 16, 4096, 357, 4107, 189,
     20481, 189, 1
-},
-// skyBox23
-{
+};
+
+constexpr uint16_t skyBox23[]{
     2323, 4109, 189, 20483, 189, 1, 4097, 189, 3, 36864, 202, 8, 4107, 202,
     4097, 189, 3, 4097, 202, 12288, 202, 90, 4097, 202, 12288, 202, 90, 4102,
     202, 4097, 189, 0, 20480, 406, 0, 0, 14, 20480, 406, 0, 18, 14, 20480, 406,
@@ -648,9 +646,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     12288, 305, 36, 36, 89, 4097, 202, 4097, 189, 3, 4103, 202, 8194, 90, 4097,
     202, 4097, 189, 3, 36864, 202, 8, 4102, 202, 4096, 10, 36, 1890, 4096, 10,
     0, 1908, 4096, 10, 36, 1926, 4097, 202, 4112, 189, 20482, 189, 1
-},
-// skyBox24
-{
+};
+
+constexpr uint16_t skyBox24[]{
     5135, 4107, 189, 20482, 189, 1, 4096, 189, 11, 4096, 357, 4097, 189, 10,
     4097, 357, 4097, 189, 1, 53248, 202, 26, 24, 20483, 202, 26, 53248, 202,
     26, 40, 2, 4097, 357, 4097, 189, 1, 20485, 202, 26, 20480, 10, 0, 486, 26,
@@ -673,9 +671,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     20480, 10, 18, 504, 26, 20480, 10, 18, 522, 26, 4097, 357, 4097, 189, 1,
     53248, 202, 26, 16, 20483, 202, 26, 53248, 202, 26, 32, 2, 4097, 357, 4097,
     189, 10, 4097, 357, 4097, 189, 11, 4096, 357, 4108, 189, 20482, 189, 1
-},
-// skyBox25
-{
+};
+
+constexpr uint16_t skyBox25[]{
     3083, 4104, 189, 20481, 189, 1, 4096, 189, 6, 4097, 370, 4097, 189, 6,
     32768, 1, 4096, 370, 4097, 189, 2, 36864, 370, 8, 4096, 370, 1, 32768, 1,
     4096, 370, 4097, 189, 2, 32768, 1, 4096, 370, 1, 32768, 1, 4096, 370, 4097,
@@ -684,9 +682,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     370, 1, 32768, 1, 4096, 370, 4097, 189, 2, 36864, 370, 8, 4096, 370, 1,
     32768, 1, 4096, 370, 4097, 189, 6, 32768, 1, 4096, 370, 4097, 189, 6, 4097,
     370, 4105, 189, 20481, 189, 1
-},
-// skyBox26
-{
+};
+
+constexpr uint16_t skyBox26[]{
     3591, 4099, 189, 20482, 189, 1, 4096, 189, 3, 4098, 189, 4, 4097, 189, 4,
     4097, 189, 2, 36864, 565, 0, 0, 4096, 36864, 565, 0, 18, 4096, 4097, 189,
     2, 36864, 565, 18, 0, 4096, 36864, 565, 18, 18, 4096, 4097, 189, 1, 8194,
@@ -696,9 +694,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     1, 4096, 305, 18, 0, 12288, 305, 18, 18, 145, 12288, 305, 18, 36, 145,
     4097, 189, 1, 12288, 305, 36, 0, 145, 12288, 305, 36, 18, 145, 12288, 305,
     36, 36, 145, 4097, 189, 3, 4101, 189, 20482, 189, 1
-},
-// skyBox27
-{
+};
+
+constexpr uint16_t skyBox27[]{
     4370, 4109, 189, 20483, 189, 1, 4096, 189, 2, 4096, 158, 45056, 158, 139,
     40, 8192, 139, 7, 4099, 189, 2, 4098, 158, 7, 4096, 189, 4096, 158, 4097,
     189, 1, 36864, 158, 8, 4096, 158, 4102, 357, 4096, 10, 36, 1782, 4096, 10,
@@ -718,9 +716,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     10, 18, 1782, 4096, 10, 0, 1800, 4096, 10, 18, 1818, 4097, 158, 4097, 189,
     2, 4098, 158, 7, 4096, 189, 4096, 158, 4097, 189, 2, 4096, 158, 45056, 158,
     139, 32, 8192, 139, 7, 4112, 189, 20483, 189, 1
-},
-// skyBox28
-{
+};
+
+constexpr uint16_t skyBox28[]{
     4879, 4105, 189, 20483, 189, 1, 4097, 189, 0, 36864, 202, 24, 4106, 202,
     4097, 189, 0, 4107, 202, 4097, 189, 0, 4097, 202, 8199, 82, 4097, 202,
     4097, 189, 0, 4097, 202, 12295, 577, 82, 4097, 202, 4097, 189, 0, 4097,
@@ -741,9 +739,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     4097, 189, 0, 4101, 202, 45056, 202, 82, 40, 8194, 82, 4097, 202, 4097,
     189, 0, 36864, 202, 16, 4101, 202, 4096, 10, 54, 378, 4096, 10, 90, 396,
     4096, 10, 54, 414, 4097, 202, 4108, 189, 20482, 189, 1
-},
-// skyBox29
-{
+};
+
+constexpr uint16_t skyBox29[]{
     5906, 4109, 189, 20483, 189, 1, 4096, 189, 13, 4096, 189, 4096, 202, 4097,
     189, 13, 4097, 202, 4097, 189, 0, 36864, 202, 24, 4104, 202, 4096, 10, 0,
     486, 4096, 10, 36, 504, 4096, 10, 0, 522, 4097, 202, 4097, 189, 0, 4104,
@@ -782,9 +780,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     189, 0, 36864, 202, 16, 4104, 202, 4096, 10, 0, 486, 4096, 10, 18, 504,
     4096, 10, 18, 522, 4097, 202, 4097, 189, 13, 4097, 202, 4097, 189, 13,
     4096, 189, 4096, 202, 4110, 189, 20483, 189, 1
-},
-// skyBox30
-{
+};
+
+constexpr uint16_t skyBox30[]{
     5134, 4106, 189, 20482, 189, 1, 4096, 189, 10, 4098, 189, 5, 4096, 202, 2,
     8192, 82, 4096, 357, 4097, 189, 0, 4101, 202, 12288, 10, 18, 486, 82,
     12288, 10, 18, 504, 82, 12288, 10, 0, 522, 82, 4097, 357, 4097, 189, 0,
@@ -807,9 +805,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     486, 82, 12288, 10, 0, 504, 82, 12288, 10, 0, 522, 82, 4097, 357, 4097,
     189, 5, 4096, 202, 2, 8192, 82, 4096, 357, 4097, 189, 10, 4108, 189, 20482,
     189, 1
-},
-// skyBox31
-{
+};
+
+constexpr uint16_t skyBox31[]{
     7698, 4110, 189, 20482, 189, 1, 4096, 189, 14, 4096, 202, 4097, 189, 14,
     4096, 202, 4097, 189, 13, 36864, 202, 8, 4096, 202, 4097, 189, 2, 36864,
     202, 8, 4099, 202, 4096, 91, 144, 0, 4096, 91, 144, 18, 4096, 91, 144, 36,
@@ -839,9 +837,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     0, 4096, 91, 144, 18, 4096, 91, 144, 36, 2, 4097, 202, 4097, 189, 13,
     36864, 202, 8, 4096, 202, 4097, 189, 14, 4096, 202, 4097, 189, 14, 4096,
     202, 4111, 189, 20482, 189, 1
-},
-// skyBox32
-{
+};
+
+constexpr uint16_t skyBox32[]{
     3092, 4112, 189, 20482, 189, 1, 4096, 189, 36864, 350, 24, 4107, 350,
     20480, 10, 18, 1782, 26, 20480, 10, 18, 1800, 26, 20480, 10, 0, 1818, 26,
     4097, 350, 4097, 189, 4096, 350, 61440, 350, 182, 6656, 32, 24589, 182,
@@ -871,9 +869,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     40, 24589, 182, 6656, 4097, 350, 4097, 189, 36864, 350, 16, 4107, 350,
     20480, 10, 36, 1782, 26, 20480, 10, 0, 1800, 26, 20480, 10, 36, 1818, 26,
     4097, 350, 4113, 189, 20482, 189, 1
-},
-// skyBox33
-{
+};
+
+constexpr uint16_t skyBox33[]{
     8211, 4111, 189, 20482, 189, 1, 4096, 189, 15, 4096, 202, 4097, 189, 14,
     36864, 202, 8, 4096, 202, 4097, 189, 14, 4097, 202, 4097, 189, 13, 36864,
     370, 8, 4097, 202, 4097, 189, 13, 4096, 370, 4097, 202, 4097, 189, 2,
@@ -911,9 +909,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     4097, 189, 13, 36864, 370, 8, 4097, 202, 4097, 189, 14, 4097, 202, 4097,
     189, 14, 36864, 202, 8, 4096, 202, 4097, 189, 15, 4096, 202, 4112, 189,
     20482, 189, 1
-},
-// skyBox34
-{
+};
+
+constexpr uint16_t skyBox34[]{
     4878, 4106, 189, 20482, 189, 1, 4096, 189, 10, 4096, 202, 4097, 189, 3,
     36864, 202, 16, 4097, 202, 4096, 10, 18, 486, 4096, 10, 0, 504, 4096, 10,
     0, 522, 4097, 202, 4097, 189, 4, 4097, 202, 8194, 82, 4097, 202, 4097, 189,
@@ -940,9 +938,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     202, 4097, 189, 3, 36864, 202, 24, 4097, 202, 4096, 10, 36, 486, 4096, 10,
     18, 504, 4096, 10, 36, 522, 4097, 202, 4097, 189, 10, 4096, 202, 4107, 189,
     20482, 189, 1
-},
-// skyBox35
-{
+};
+
+constexpr uint16_t skyBox35[]{
     4373, 4113, 189, 20482, 189, 1, 4096, 189, 5, 36864, 357, 8, 36864, 357,
     40, 9, 4096, 357, 4097, 189, 5, 4097, 357, 4096, 561, 7, 4097, 357, 4097,
     189, 5, 4096, 357, 12288, 561, 179, 4101, 357, 20480, 10, 72, 378, 26,
@@ -972,9 +970,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     72, 414, 26, 4097, 357, 4097, 189, 5, 4097, 357, 4096, 561, 7, 4097, 357,
     4097, 189, 5, 36864, 357, 8, 36864, 357, 32, 9, 4096, 357, 4114, 189,
     20482, 189, 1
-},
-// skyBox36
-{
+};
+
+constexpr uint16_t skyBox36[]{
     5392, 4108, 189, 20482, 189, 1, 4096, 189, 11, 4097, 202, 4097, 189, 1,
     4096, 202, 0, 4096, 202, 0, 4096, 202, 0, 4096, 202, 2, 4097, 202, 4097,
     189, 0, 4096, 202, 12289, 202, 82, 8192, 82, 12288, 202, 82, 8192, 82,
@@ -997,9 +995,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     82, 8192, 82, 12288, 202, 82, 8195, 82, 4097, 202, 4097, 189, 1, 4096, 202,
     0, 4096, 202, 0, 4096, 202, 0, 4096, 202, 2, 4097, 202, 4097, 189, 11,
     4097, 202, 4109, 189, 20482, 189, 1
-},
-// skyBox37
-{
+};
+
+constexpr uint16_t skyBox37[]{
     5904, 4108, 189, 20482, 189, 1, 4096, 189, 2, 36864, 313, 40, 8, 4098, 189,
     2, 4096, 313, 36864, 313, 40, 7, 4098, 189, 2, 4097, 313, 4100, 311, 4096,
     10, 0, 1512, 4096, 10, 36, 1530, 4096, 10, 0, 1548, 4096, 311, 4097, 189,
@@ -1036,9 +1034,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     36, 1512, 4096, 10, 18, 1530, 4096, 10, 18, 1548, 4096, 311, 4097, 189, 2,
     4096, 313, 36864, 313, 32, 7, 4098, 189, 2, 36864, 313, 32, 8, 4110, 189,
     20482, 189, 1
-},
-// skyBox38
-{
+};
+
+constexpr uint16_t skyBox38[]{
     5139, 4110, 189, 20483, 189, 1, 4096, 189, 14, 4099, 189, 3, 4096, 312,
     24576, 139, 7168, 9, 4098, 189, 3, 4096, 312, 4107, 311, 4097, 189, 2,
     4097, 312, 12288, 311, 142, 0, 8192, 142, 0, 8192, 142, 0, 12288, 305, 0,
@@ -1062,9 +1060,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     4096, 311, 7, 4098, 311, 4097, 189, 3, 4096, 312, 24576, 139, 7168, 7,
     4098, 311, 4097, 189, 14, 4097, 311, 4097, 189, 15, 4096, 311, 4112, 189,
     20482, 189, 1
-},
-// skyBox39
-{
+};
+
+constexpr uint16_t skyBox39[]{
     5903, 4105, 189, 20484, 189, 1, 4096, 189, 0, 36864, 202, 24, 4096, 202,
     36864, 202, 40, 5, 4100, 189, 0, 4100, 202, 4096, 42, 18, 720, 4096, 42,
     18, 738, 2, 4096, 189, 4096, 202, 4097, 189, 0, 36864, 202, 16, 4096, 202,
@@ -1110,9 +1108,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     4100, 202, 4096, 42, 18, 720, 4096, 42, 18, 738, 2, 4096, 189, 4096, 202,
     4097, 189, 0, 36864, 202, 16, 4096, 202, 36864, 202, 32, 5, 4109, 189,
     20484, 189, 1
-},
-// skyBox40
-{
+};
+
+constexpr uint16_t skyBox40[]{
     5649, 4108, 189, 20483, 189, 1, 4096, 189, 1, 4096, 312, 9, 4099, 189, 1,
     4096, 312, 10, 4098, 189, 1, 4096, 312, 4096, 202, 4097, 214, 4096, 19, 90,
     162, 4096, 42, 0, 216, 4096, 42, 0, 234, 4, 4096, 202, 4097, 189, 0, 4097,
@@ -1137,9 +1135,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     1, 4096, 312, 4096, 202, 4097, 214, 4096, 19, 90, 162, 4096, 42, 0, 216,
     4096, 42, 0, 234, 4, 4096, 202, 4097, 189, 1, 4096, 312, 10, 4098, 189, 1,
     4096, 312, 9, 4111, 189, 20483, 189, 1
-},
-// skyBox41
-{
+};
+
+constexpr uint16_t skyBox41[]{
     4883, 4110, 189, 20483, 189, 1, 4096, 189, 0, 4096, 202, 36864, 202, 40,
     11, 4099, 189, 0, 36864, 202, 8, 4096, 202, 4104, 311, 4096, 10, 18, 486,
     4096, 10, 0, 504, 4096, 10, 36, 522, 4097, 311, 4097, 189, 0, 36864, 202,
@@ -1169,9 +1167,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     8, 4096, 202, 4104, 311, 4096, 10, 36, 486, 4096, 10, 18, 504, 4096, 10,
     36, 522, 4097, 311, 4097, 189, 0, 4096, 202, 36864, 202, 32, 11, 4113, 189,
     20483, 189, 1
-},
-// skyBox42
-{
+};
+
+constexpr uint16_t skyBox42[]{
     6419, 4109, 189, 20484, 189, 1, 4096, 189, 13, 4100, 189, 6, 36864, 19,
     342, 576, 24, 6, 4099, 189, 5, 36864, 19, 144, 576, 24, 4100, 311, 4096,
     10, 0, 486, 4096, 10, 18, 504, 4096, 10, 0, 522, 4096, 202, 4096, 311,
@@ -1223,9 +1221,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     36864, 19, 180, 576, 16, 4100, 311, 4096, 10, 36, 486, 4096, 10, 36, 504,
     4096, 10, 18, 522, 4096, 202, 4096, 311, 4097, 189, 6, 36864, 19, 360, 576,
     16, 6, 4099, 189, 13, 4113, 189, 20484, 189, 1
-},
-// skyBox43
-{
+};
+
+constexpr uint16_t skyBox43[]{
     4625, 4109, 189, 20482, 189, 1, 4096, 189, 0, 36864, 202, 24, 4103, 202,
     20480, 10, 0, 108, 28, 20480, 10, 18, 126, 28, 20480, 10, 18, 144, 28,
     4097, 202, 4097, 189, 0, 4096, 202, 12294, 202, 142, 45056, 202, 142, 32,
@@ -1255,9 +1253,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     202, 142, 45056, 202, 142, 40, 8194, 142, 4096, 311, 4096, 202, 4097, 189,
     0, 36864, 202, 16, 4103, 202, 20480, 10, 36, 108, 28, 20480, 10, 0, 126,
     28, 20480, 10, 0, 144, 28, 4097, 202, 4110, 189, 20482, 189, 1
-},
-// skyBox44
-{
+};
+
+constexpr uint16_t skyBox44[]{
     6423, 4114, 189, 20483, 189, 1, 4096, 189, 7, 36864, 54, 24, 4097, 54,
     4098, 202, 36864, 202, 40, 3, 4097, 202, 4097, 189, 5, 36864, 54, 24, 4096,
     54, 45056, 54, 21, 32, 8192, 21, 45056, 54, 21, 16, 4100, 202, 4096, 10,
@@ -1301,9 +1299,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     202, 4096, 10, 18, 486, 4096, 10, 18, 504, 4096, 10, 18, 522, 4097, 202,
     4097, 189, 7, 36864, 54, 16, 4097, 54, 4098, 202, 36864, 202, 32, 3, 4097,
     202, 4115, 189, 20483, 189, 1
-},
-// skyBox45
-{
+};
+
+constexpr uint16_t skyBox45[]{
     7955, 4111, 189, 20482, 189, 1, 4096, 189, 7, 36864, 54, 24, 4098, 311,
     36864, 311, 40, 2, 4096, 202, 4097, 189, 5, 36864, 54, 24, 4097, 54, 4096,
     311, 4098, 202, 4096, 10, 0, 486, 4096, 10, 18, 504, 4096, 10, 0, 522,
@@ -1359,9 +1357,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     4096, 10, 0, 486, 4096, 10, 0, 504, 4096, 10, 0, 522, 4096, 202, 4097, 189,
     8, 36864, 311, 16, 3, 36864, 311, 16, 4096, 311, 4096, 202, 4097, 189, 14,
     36864, 311, 16, 4096, 311, 4111, 189, 20483, 189, 1
-},
-// skyBox46
-{
+};
+
+constexpr uint16_t skyBox46[]{
     3084, 4102, 189, 20483, 189, 1, 4097, 189, 5, 4099, 370, 4097, 189, 6,
     4097, 350, 4096, 370, 4097, 189, 0, 36864, 370, 8, 4097, 370, 36864, 370,
     40, 1, 4097, 350, 4096, 370, 4097, 189, 0, 32768, 1, 4097, 350, 4096, 370,
@@ -1371,9 +1369,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     4097, 350, 4096, 370, 4097, 189, 0, 36864, 370, 8, 4097, 370, 36864, 370,
     32, 1, 4097, 350, 4096, 370, 4097, 189, 6, 4097, 350, 4096, 370, 4097, 189,
     5, 4099, 370, 4103, 189, 20483, 189, 1, 4096, 189
-},
-// skyBox47
-{
+};
+
+constexpr uint16_t skyBox47[]{
     3081, 4098, 189, 20484, 189, 1, 4097, 189, 4102, 311, 4097, 189, 4096, 311,
     8192, 82, 8192, 143, 12288, 305, 0, 0, 143, 12288, 305, 0, 18, 143, 12288,
     305, 0, 36, 82, 4096, 311, 4097, 189, 4096, 311, 8192, 82, 8192, 143,
@@ -1390,9 +1388,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     189, 4096, 311, 8192, 82, 8192, 143, 12288, 33, 18, 264, 143, 12288, 14,
     414, 0, 143, 12288, 14, 414, 18, 82, 4096, 311, 4097, 189, 4102, 311, 4099,
     189, 20484, 189, 1, 4096, 189
-},
-// skyBox48
-{
+};
+
+constexpr uint16_t skyBox48[]{
     5134, 4106, 189, 20482, 189, 1, 4096, 189, 5, 4097, 202, 2, 4096, 202,
     4097, 189, 5, 4096, 202, 24578, 82, 7424, 24576, 82, 6400, 4096, 202, 4097,
     189, 3, 4097, 202, 24580, 82, 7424, 36864, 202, 4096, 4097, 189, 3, 4096,
@@ -1426,9 +1424,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     24576, 82, 6400, 24576, 82, 7424, 36864, 202, 4096, 4097, 189, 5, 4096,
     202, 24579, 82, 7424, 4096, 202, 4097, 189, 5, 4097, 202, 2, 4096, 202,
     4107, 189, 20482, 189, 1
-},
-// skyBox49
-{
+};
+
+constexpr uint16_t skyBox49[]{
     4628, 4111, 189, 20483, 189, 1, 4096, 189, 4, 8192, 145, 36864, 311, 40, 8,
     4099, 189, 3, 8193, 145, 12288, 311, 145, 4096, 311, 4097, 54, 4097, 311,
     4097, 54, 4099, 311, 4097, 189, 4, 8192, 145, 4096, 311, 45056, 311, 82,
@@ -1464,9 +1462,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     486, 4096, 10, 18, 504, 4096, 10, 18, 522, 4097, 311, 4097, 189, 4, 8192,
     145, 36864, 311, 32, 8, 4097, 311, 4097, 189, 15, 4096, 189, 4096, 311,
     4113, 189, 20482, 189, 1
-},
-// skyBox50
-{
+};
+
+constexpr uint16_t skyBox50[]{
     7188, 4111, 189, 20483, 189, 1, 4096, 189, 2, 4096, 311, 36864, 311, 40, 8,
     36864, 192, 8, 4098, 202, 4097, 189, 2, 4096, 311, 12288, 592, 0, 0, 82,
     12288, 592, 0, 18, 82, 12288, 592, 0, 36, 82, 8196, 82, 0, 8192, 60, 12289,
@@ -1494,9 +1492,9 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     8198, 82, 4099, 202, 4097, 189, 2, 4096, 311, 12288, 592, 18, 0, 82, 12288,
     592, 18, 18, 82, 12288, 592, 18, 36, 82, 8198, 82, 4099, 202, 4097, 189, 2,
     4096, 311, 36864, 311, 32, 8, 4099, 202, 4112, 189, 20483, 189, 1
-},
-// skyBox51
-{
+};
+
+constexpr uint16_t skyBox51[]{
     5650, 4110, 189, 20482, 189, 1, 4096, 189, 1, 53248, 313, 20, 8, 20480,
     313, 20, 10, 4098, 189, 1, 20480, 313, 20, 20481, 175, 20, 4096, 202,
     20481, 175, 20, 4096, 202, 20481, 175, 20, 36864, 202, 40, 2, 4096, 202,
@@ -1541,9 +1539,21 @@ std::vector<std::vector<uint16_t>> skyBoxData{
     175, 20, 4096, 202, 20481, 175, 20, 4096, 202, 20481, 175, 20, 36864, 202,
     32, 2, 4096, 202, 4097, 189, 1, 53248, 313, 20, 8, 20480, 313, 20, 10,
     4112, 189, 20482, 189, 1
-},
+};
+
+constexpr std::span<const uint16_t> skyBoxData[]{
+    skyBox1, skyBox2, skyBox3, skyBox4, skyBox5, skyBox6, skyBox7, skyBox8,
+    skyBox9, skyBox10, skyBox11, skyBox12, skyBox13, skyBox14, skyBox15,
+    skyBox16, skyBox17, skyBox18, skyBox19, skyBox20, skyBox21, skyBox22,
+    skyBox23, skyBox24, skyBox25, skyBox26, skyBox27, skyBox28, skyBox29,
+    skyBox30, skyBox31, skyBox32, skyBox33, skyBox34, skyBox35, skyBox36,
+    skyBox37, skyBox38, skyBox39, skyBox40, skyBox41, skyBox42, skyBox43,
+    skyBox44, skyBox45, skyBox46, skyBox47, skyBox48, skyBox49, skyBox50,
+    skyBox51
 };
 // clang-format on
+
+TileBufferCache skyBoxCache{skyBoxData};
 } // namespace
 
 namespace Data
@@ -1551,7 +1561,7 @@ namespace Data
 
 TileBuffer getSkyBox(int skyBoxId, const FramedBitset &framedTiles)
 {
-    return {skyBoxData[skyBoxId].data(), framedTiles};
+    return skyBoxCache.get(skyBoxId, framedTiles);
 }
 
 } // namespace Data
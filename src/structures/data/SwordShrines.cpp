@@ -3,16 +3,19 @@
 namespace
 {
 // clang-format off
-std::vector<std::vector<uint16_t>> shrineData{
-// swordShrine1
-{
+constexpr uint16_t swordShrine1[]{
     2308, 2, 36864, 273, 8, 2, 4096, 273, 1, 36864, 273, 8, 4096, 273, 4096,
     187, 918, 0, 4096, 187, 918, 18, 4097, 273, 4096, 187, 936, 0, 4096, 187,
     936, 18, 4097, 273, 4096, 187, 954, 0, 4096, 187, 954, 18, 4097, 273, 1,
     36864, 273, 8, 4096, 273, 2, 4096, 273, 2, 36864, 273, 8
-},
+};
+
+constexpr std::span<const uint16_t> shrineData[]{
+    swordShrine1
 };
 // clang-format on
+
+TileBufferCache shrineCache{shrineData};
 } // namespace
 
 namespace Data
@@ -20,7 +23,7 @@ namespace Data
 
 TileBuffer getSwordShrine(const FramedBitset &framedTiles)
 {
-    return {shrineData[0].data(), framedTiles};
+    return shrineCache.get(0, framedTiles);
 }
 
 } // namespace Data
@@ -3,9 +3,7 @@
 namespace
 {
 // clang-format off
-std::vector<std::vector<uint16_t>> torchData{
-// torchFavor
-{
+constexpr uint16_t torchFavor[]{
     3861, 4122, 189, 13, 4099, 189, 7, 4097, 432, 4096, 369, 36864, 369, 40, 4,
     4098, 189, 5, 12289, 4, 0, 198, 73, 0, 4096, 432, 4096, 680, 4096, 357,
     4096, 369, 36864, 369, 40, 1, 4097, 369, 4097, 189, 4, 12288, 4, 0, 22, 73,
@@ -33,9 +31,9 @@ std::vector<std::vector<uint16_t>> torchData{
     1, 12288, 4, 0, 198, 73, 3, 12289, 4, 0, 44, 73, 0, 4096, 432, 4096, 680,
     4096, 357, 4096, 369, 36864, 369, 32, 1, 4097, 369, 4097, 189, 9, 4097,
     432, 4096, 369, 36864, 369, 32, 4, 4098, 189, 17, 4117, 189
-},
-// torchLeft
-{
+};
+
+constexpr uint16_t torchLeft[]{
     5404, 4129, 189, 14, 4105, 189, 18, 4103, 189, 20, 4101, 189, 8, 12288, 4,
     0, 154, 73, 11, 4101, 189, 4, 12290, 4, 0, 44, 73, 1, 12289, 4, 0, 44, 73,
     10, 4100, 189, 1, 12289, 4, 0, 44, 73, 2, 12289, 4, 0, 44, 73, 12288, 4, 0,
@@ -65,9 +63,9 @@ std::vector<std::vector<uint16_t>> torchData{
     2048, 53248, 158, 28, 2088, 0, 4100, 189, 18, 53248, 158, 28, 2064, 53250,
     158, 28, 2048, 4101, 189, 19, 53248, 158, 28, 2064, 53248, 158, 28, 2048,
     4104, 189, 18, 4124, 189
-},
-// torchRight
-{
+};
+
+constexpr uint16_t torchRight[]{
     5404, 4131, 189, 18, 4100, 189, 20, 53248, 158, 28, 2072, 53248, 158, 28,
     2048, 4100, 189, 18, 53248, 158, 28, 2072, 53250, 158, 28, 2048, 4099, 189,
     17, 53248, 158, 28, 2072, 53250, 158, 28, 2048, 53248, 158, 28, 2080, 0,
@@ -97,9 +95,9 @@ std::vector<std::vector<uint16_t>> torchData{
     0, 352, 73, 9, 4100, 189, 4, 12290, 4, 0, 44, 73, 1, 12289, 4, 0, 44, 73,
     10, 4100, 189, 8, 12288, 4, 0, 154, 73, 11, 4102, 189, 20, 4103, 189, 18,
     4107, 189, 14, 4130, 189
-},
-// torchUp
-{
+};
+
+constexpr uint16_t torchUp[]{
     3878, 4138, 189, 28, 4102, 189, 10, 36864, 208, 2048, 53248, 208, 28, 2048,
     53248, 635, 28, 2048, 18, 4099, 189, 7, 12288, 4, 0, 154, 73, 0, 12289, 4,
     0, 44, 73, 53249, 177, 3, 2048, 53249, 635, 28, 2048, 17, 4099, 189, 6,
@@ -134,9 +132,14 @@ std::vector<std::vector<uint16_t>> torchData{
     12289, 4, 0, 154, 73, 1, 12289, 4, 0, 418, 73, 53248, 177, 3, 2048, 36864,
     177, 2048, 53249, 635, 28, 2048, 17, 4100, 189, 10, 36864, 208, 2048,
     53248, 208, 28, 2048, 53248, 635, 28, 2048, 18, 4102, 189, 28, 4137, 189
-},
+};
+
+constexpr std::span<const uint16_t> torchData[]{
+    torchFavor, torchLeft, torchRight, torchUp
 };
 // clang-format on
+
+TileBufferCache torchCache{torchData};
 } // namespace
 
 namespace Data
@@ -144,7 +147,7 @@ namespace Data
 
 TileBuffer getTorch(Torch torchId, const FramedBitset &framedTiles)
 {
-    return {torchData[static_cast<int>(torchId)].data(), framedTiles};
+    return torchCache.get(static_cast<int>(torchId), framedTiles);
 }
 
 } // namespace Data
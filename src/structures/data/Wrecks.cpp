@@ -3,29 +3,27 @@
 namespace
 {
 // clang-format off
-std::vector<std::vector<uint16_t>> wreckData{
-// wreck1
-{
+constexpr uint16_t wreck1[]{
     1287, 4098, 189, 53248, 189, 1, 16, 20480, 189, 1, 4098, 189, 20482, 150,
     28, 4097, 397, 4097, 189, 20482, 150, 28, 4097, 397, 4097, 189, 20482, 150,
     28, 4097, 397, 4099, 189, 53248, 189, 1, 24, 20480, 189, 1, 4097, 189
-},
-// wreck2
-{
+};
+
+constexpr uint16_t wreck2[]{
     1287, 4098, 189, 53248, 189, 1, 16, 20480, 189, 1, 4098, 189, 53250, 150,
     28, 2049, 4097, 397, 4097, 189, 53250, 150, 28, 2049, 4097, 397, 4097, 189,
     53250, 150, 28, 2049, 4097, 397, 4099, 189, 53248, 189, 1, 24, 20480, 189,
     1, 4097, 189
-},
-// wreck3
-{
+};
+
+constexpr uint16_t wreck3[]{
     1285, 4097, 189, 20482, 189, 1, 4096, 189, 36864, 376, 0, 0, 1, 36864, 376,
     0, 18, 1, 20480, 159, 28, 4097, 189, 36864, 376, 18, 0, 1, 36864, 376, 18,
     18, 1, 20480, 159, 28, 4097, 189, 32769, 1, 20480, 159, 28, 4099, 189,
     20481, 189, 1
-},
-// wreck4
-{
+};
+
+constexpr uint16_t wreck4[]{
     3338, 4101, 189, 20482, 189, 1, 4097, 189, 32773, 1, 4096, 189, 53248, 159,
     28, 24, 4097, 189, 32773, 1, 53248, 159, 28, 24, 53248, 159, 28, 32, 4097,
     189, 32772, 1, 53248, 159, 28, 24, 53248, 159, 28, 32, 4098, 189, 32771, 1,
@@ -38,9 +36,9 @@ std::vector<std::vector<uint16_t>> wreckData{
     189, 53248, 159, 28, 32, 36865, 213, 1, 45056, 213, 148, 1, 40963, 148, 1,
     4097, 189, 32771, 1, 40962, 148, 1, 4098, 189, 32772, 1, 40961, 148, 1,
     4104, 189, 20482, 189, 1
-},
-// wreck5
-{
+};
+
+constexpr uint16_t wreck5[]{
     2568, 4099, 189, 20483, 189, 1, 4096, 189, 32771, 1, 20481, 158, 28, 4097,
     189, 32770, 1, 57344, 42, 7168, 1, 20481, 158, 28, 4097, 189, 61440, 240,
     594, 54, 139, 7168, 1, 61440, 240, 594, 72, 139, 7168, 1, 61440, 240, 594,
@@ -51,9 +49,9 @@ std::vector<std::vector<uint16_t>> wreckData{
     90, 139, 7168, 1, 57344, 42, 7168, 1, 20481, 158, 28, 4097, 189, 32770, 1,
     57344, 42, 7168, 1, 20481, 158, 28, 4097, 189, 32771, 1, 20481, 158, 28,
     4097, 189, 32771, 1, 20480, 158, 28, 4101, 189, 20482, 189, 1, 4096, 189
-},
-// wreck6
-{
+};
+
+constexpr uint16_t wreck6[]{
     2567, 4100, 189, 20481, 189, 1, 4096, 189, 53248, 159, 28, 16, 61440, 159,
     148, 28, 40, 32769, 1, 4098, 189, 32768, 1, 61440, 159, 148, 28, 16, 53248,
     159, 28, 40, 20481, 321, 28, 4097, 189, 32769, 1, 53248, 159, 28, 16,
@@ -62,15 +60,15 @@ std::vector<std::vector<uint16_t>> wreckData{
     28, 16, 4097, 189, 32770, 1, 20481, 321, 28, 4097, 189, 32770, 1, 20481,
     321, 28, 4097, 189, 32770, 1, 4096, 189, 20480, 321, 28, 4100, 189, 20482,
     189, 1
-},
-// wreck7
-{
+};
+
+constexpr uint16_t wreck7[]{
     2052, 4096, 189, 20482, 189, 1, 4097, 189, 20480, 321, 28, 4097, 189,
     20481, 321, 28, 4097, 189, 20481, 321, 28, 4097, 189, 20481, 321, 28, 4097,
     189, 20480, 321, 28, 4098, 189, 20480, 321, 28, 4098, 189, 20482, 189, 1
-},
-// wreck8
-{
+};
+
+constexpr uint16_t wreck8[]{
     3335, 4099, 189, 20482, 189, 1, 4096, 189, 32770, 1, 20480, 158, 28, 53248,
     158, 28, 40, 4097, 189, 32768, 1, 57345, 42, 7168, 1, 61440, 158, 42, 7196,
     8, 20480, 158, 28, 4097, 189, 57347, 42, 7168, 1, 20480, 158, 28, 4097,
@@ -82,9 +80,9 @@ std::vector<std::vector<uint16_t>> wreckData{
     189, 32768, 1, 57344, 42, 7168, 1, 20480, 158, 28, 53248, 158, 28, 32,
     4098, 189, 32768, 1, 57344, 42, 7168, 1, 20480, 158, 28, 4099, 189, 32769,
     1, 20480, 158, 28, 4101, 189, 20483, 189, 1
-},
-// wreck9
-{
+};
+
+constexpr uint16_t wreck9[]{
     2312, 4099, 189, 20483, 189, 1, 4096, 189, 32771, 1, 53248, 30, 28, 40,
     4098, 189, 32771, 1, 20480, 30, 28, 53248, 30, 28, 40, 4097, 189, 32769, 1,
     57344, 42, 7168, 1, 32768, 1, 61440, 30, 42, 7196, 8, 20480, 30, 28, 4097,
@@ -92,9 +90,9 @@ std::vector<std::vector<uint16_t>> wreckData{
     28, 1, 61443, 575, 42, 7196, 1, 20480, 30, 28, 4097, 189, 32769, 1, 57346,
     42, 7168, 1, 20480, 30, 28, 4097, 189, 32772, 1, 20480, 30, 28, 4101, 189,
     20482, 189, 1
-},
-// wreck10
-{
+};
+
+constexpr uint16_t wreck10[]{
     2309, 4097, 189, 20482, 189, 1, 4096, 189, 32768, 1, 57344, 150, 7168, 1,
     20480, 321, 28, 4097, 189, 36864, 214, 1, 61440, 214, 150, 7168, 1, 20480,
     321, 28, 4097, 189, 32768, 1, 57344, 150, 7168, 1, 20480, 321, 28, 4097,
@@ -102,14 +100,20 @@ std::vector<std::vector<uint16_t>> wreckData{
     32768, 1, 57344, 150, 7168, 1, 20480, 321, 28, 4097, 189, 36864, 214, 1,
     61440, 214, 150, 7168, 1, 20480, 321, 28, 4097, 189, 32768, 1, 57344, 150,
     7168, 1, 20480, 321, 28, 4098, 189, 20482, 189, 1
-},
-// wreck11
-{
+};
+
+constexpr uint16_t wreck11[]{
     1029, 4098, 189, 20481, 189, 1, 4096, 189, 53248, 159, 28, 8, 20481, 159,
     28, 4097, 189, 32768, 1, 20481, 159, 28, 4099, 189, 20481, 189, 1
-},
+};
+
+constexpr std::span<const uint16_t> wreckData[]{
+    wreck1, wreck2, wreck3, wreck4, wreck5, wreck6, wreck7, wreck8, wreck9,
+    wreck10, wreck11
 };
 // clang-format on
+
+TileBufferCache wreckCache{wreckData};
 } // namespace
 
 namespace Data
@@ -117,7 +121,7 @@ namespace Data
 
 TileBuffer getWreck(int wreckId, const FramedBitset &framedTiles)
 {
-    return {wreckData[wreckId].data(), framedTiles};
+    return wreckCache.get(wreckId, framedTiles);
 }
 
 } // namespace Data
@@ -5,8 +5,8 @@
 #include "Util.h"
 #include "World.h"
 #include "ids/Paint.h"
+#include "ids/TileTraits.h"
 #include "ids/WallID.h"
-#include "vendor/frozen/set.h"
 #include <iostream>
 
 void genGlaciation(Random &rnd, World &world)
@@ -17,68 +17,6 @@ void genGlaciation(Random &rnd, World &world)
         (world.getCavernLevel() + 2 * world.getUnderworldLevel()) / 3;
     int underworldHeight = world.getHeight() - world.getUnderworldLevel();
     int lavaLevel = world.getUnderworldLevel() + 0.46 * underworldHeight + 1;
-    constexpr auto whiteBlocks = frozen::make_set<int>({
-        TileID::ash,
-        TileID::ashGrass,
-        TileID::clay,
-        TileID::corruptGrass,
-        TileID::corruptJungleGrass,
-        TileID::crimsand,
-        TileID::crimsandstone,
-        TileID::crimsonGrass,
-        TileID::crimsonJungleGrass,
-        TileID::crimstone,
-        TileID::dirt,
-        TileID::ebonsand,
-        TileID::ebonsandstone,
-        TileID::ebonstone,
-        TileID::grass,
-        TileID::hallowedGrass,
-        TileID::hardenedCrimsand,
-        TileID::hardenedEbonsand,
-        TileID::hardenedSand,
-        TileID::jungleGrass,
-        TileID::mud,
-        TileID::mushroomGrass,
-        TileID::sand,
-        TileID::sandstone,
-        TileID::slime,
-        TileID::stone,
-    });
-    constexpr auto cyanBlocks = frozen::make_set<int>(
-        {TileID::tinOre,
-         TileID::leadOre,
-         TileID::tungstenOre,
-         TileID::platinumOre,
-         TileID::palladiumOre,
-         TileID::orichalcumOre,
-         TileID::titaniumOre});
-    constexpr auto skyBlueBlocks = frozen::make_set<int>(
-        {TileID::copperOre,
-         TileID::ironOre,
-         TileID::silverOre,
-         TileID::goldOre,
-         TileID::cobaltOre,
-         TileID::mythrilOre,
-         TileID::adamantiteOre,
-         TileID::hellstone,
-         TileID::hellstoneBrick,
-         TileID::obsidianBrick});
-    constexpr auto whiteWalls = frozen::make_set<int>(
-        {WallID::Safe::hardenedSand,
-         WallID::Safe::sandstone,
-         WallID::Safe::smoothSandstone,
-         WallID::Unsafe::hardenedSand,
-         WallID::Unsafe::sandstone});
-    constexpr auto skyBlueWalls = frozen::make_set<int>(
-        {WallID::Safe::ember,
-         WallID::Safe::obsidianBrick,
-         WallID::Unsafe::hellstoneBrick,
-         WallID::Unsafe::obsidianBrick,
-         WallID::Unsafe::ember,
-         WallID::Unsafe::cinder,
-         WallID::Unsafe::magma,
-         WallID::Unsafe::smoulderingStone});
     parallelFor(std::views::iota(0, world.getWidth()), [&](int x) {
         int liquidDepth = 0;
         bool nearEdge = x < 350 || x > world.getWidth() - 350;
@@ -106,7 +44,7 @@ void genGlaciation(Random &rnd, World &world)
                 rnd.getCoarseNoise(x, y) < -0.25) {
                 tile.blockID = TileID::ice;
             }
-            if (whiteBlocks.contains(tile.blockID)) {
+            if (blockTraits(tile.blockID).is(BlockTrait::glacierWhite)) {
                 double snowRoof = std::midpoint(0, world.getSurfaceLevel(x));
                 if (y > snowRoof || tile.blockPaint == Paint::none) {
                     double threshold = std::lerp(
@@ -120,23 +58,25 @@ void genGlaciation(Random &rnd, World &world)
                 }
             }
             if (!world.conf.unpainted) {
+                const BlockTraits &block = blockTraits(tile.blockID);
                 if (tile.blockPaint == Paint::none) {
-                    if (whiteBlocks.contains(tile.blockID)) {
+                    if (block.is(BlockTrait::glacierWhite)) {
                         tile.blockPaint = rnd.getCoarseNoise(x, y) > 0
                                               ? Paint::white
                                               : Paint::gray;
-                    } else if (cyanBlocks.contains(tile.blockID)) {
+                    } else if (block.is(BlockTrait::glacierCyan)) {
                         tile.blockPaint = Paint::cyan;
-                    } else if (skyBlueBlocks.contains(tile.blockID)) {
+                    } else if (block.is(BlockTrait::glacierSkyBlue)) {
                         tile.blockPaint = Paint::skyBlue;
                     }
                 }
+                const WallTraits &wall = wallTraits(tile.wallID);
                 if (tile.wallPaint == Paint::none) {
-                    if (whiteWalls.contains(tile.wallID)) {
+                    if (wall.is(WallTrait::glacierWhite)) {
                         tile.wallPaint = rnd.getCoarseNoise(x, y) > 0
                                              ? Paint::white
                                              : Paint::gray;
-                    } else if (skyBlueWalls.contains(tile.wallID)) {
+                    } else if (wall.is(WallTrait::glacierSkyBlue)) {
                         tile.wallPaint = Paint::skyBlue;
                     }
                 }
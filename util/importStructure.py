@@ -1,5 +1,6 @@
 #!/usr/bin/env python3
 
+import re
 import sys
 import textwrap
 
@@ -45,7 +46,7 @@ def readBitVec(f):
 
 def loadTiles(filename):
     with open(filename, mode='rb') as f:
-        print('//', readString(f))
+        name = readString(f)
         version = readUint32(f)
         assert version == 10279, f'Unknown file version {version}'
         framedTiles = readBitVec(f)
@@ -113,7 +114,7 @@ def loadTiles(filename):
                         rle = readUint8(f)
                     elif flags[0] & 0x80 == 0x80:
                         rle = readUint16(f)
-        return (tiles, framedTiles)
+        return (name, tiles, framedTiles)
 
 # header(16)
 # blockID(16) frameX(16) frameY(16) wallID(16)
@@ -164,8 +165,40 @@ def serializeTile(tile, framedTiles):
         data.append(flags)
     return data
 
-for filename in natsorted(sys.argv[1:]):
-    (tiles, framedTiles) = loadTiles(filename)
+def toIdentifier(name, usedNames):
+    # Schematic names are free text; map them to unique C++ identifiers.
+    ident = re.sub(r'[^A-Za-z0-9_]', '_', name)
+    if not ident or ident[0].isdigit():
+        ident = 's' + ident
+    uniqueIdent = ident
+    suffix = 2
+    while uniqueIdent in usedNames:
+        uniqueIdent = f'{ident}_{suffix}'
+        suffix += 1
+    usedNames.add(uniqueIdent)
+    return uniqueIdent
+
+def printList(values, indent='    '):
+    print('\n'.join(textwrap.wrap(
+        ', '.join(values),
+        width=79,
+        initial_indent=indent,
+        subsequent_indent=indent
+    )))
+
+# Usage: importStructure.py [--table=<name>] <file>...
+tableName = 'structureData'
+filenames = sys.argv[1:]
+if filenames and filenames[0].startswith('--table='):
+    tableName = filenames[0][len('--table='):]
+    filenames = filenames[1:]
+
+names = []
+usedNames = {tableName}
+for filename in natsorted(filenames):
+    (name, tiles, framedTiles) = loadTiles(filename)
+    name = toIdentifier(name, usedNames)
+    names.append(name)
     data = [len(tiles) << 8 | len(tiles[0])]
     prevTile = []
     rleIndex = len(data)
@@ -178,11 +211,10 @@ for filename in natsorted(sys.argv[1:]):
                 rleIndex = len(data)
                 data += curTile
                 prevTile = curTile
-    print('{')
-    print('\n'.join(textwrap.wrap(
-        ', '.join([str(val) for val in data]),
-        width=79,
-        initial_indent='    ',
-        subsequent_indent='    '
-    )))
-    print('},')
+    print(f'constexpr uint16_t {name}[]{{')
+    printList([str(val) for val in data])
+    print('};')
+    print()
+print(f'constexpr std::span<const uint16_t> {tableName}[]{{')
+printList(names)
+print('};')